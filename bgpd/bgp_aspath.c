@@ -676,6 +676,8 @@ struct aspath *aspath_intern(struct aspath *aspath)
 	find = hash_get(ashash, aspath, hash_alloc_intern);
 	if (find != aspath)
 		aspath_free(aspath);
+	else
+		find->hash = aspath_key_make(find);
 
 	find->refcnt++;
 
@@ -729,6 +731,7 @@ static void *aspath_hash_alloc(void *arg)
 	new->str_len = aspath->str_len;
 	new->json = aspath->json;
 	new->asnotation = aspath->asnotation;
+	new->hash = aspath_key_make(aspath);
 
 	return new;
 }
@@ -2231,6 +2234,14 @@ unsigned int aspath_key_make(const void *p)
 	const struct aspath *aspath = p;
 	unsigned int key = 0;
 
+	/*
+	 * Interned AS paths never change, so their key is only computed
+	 * once. This keeps attrhash_key_make() from rehashing the AS path
+	 * string for every attribute lookup.
+	 */
+	if (aspath->refcnt)
+		return aspath->hash;
+
 	if (!aspath->str)
 		aspath_str_update((struct aspath *)aspath, false);
 
@@ -2340,6 +2351,7 @@ static void *bgp_aggr_aspath_hash_alloc(void *p)
 	struct aspath *aspath = NULL;
 
 	aspath = aspath_dup(ref);
+	aspath->hash = aspath_key_make(ref);
 	return aspath;
 }
 
@@ -62,6 +62,9 @@ struct aspath {
 
 	/* AS notation used by string expression of AS path */
 	enum asnotation_mode asnotation;
+
+	/* Hash key, only valid while the AS path is interned (refcnt > 0) */
+	uint32_t hash;
 };
 
 #define ASPATH_STR_DEFAULT_LEN 32
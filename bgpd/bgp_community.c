@@ -456,6 +456,8 @@ struct community *community_intern(struct community *com)
 	   hash, it should be freed.  */
 	if (find != com)
 		community_free(&com);
+	else
+		find->hash = community_hash_make(find);
 
 	/* Increment refrence counter.  */
 	find->refcnt++;
@@ -542,6 +544,10 @@ unsigned int community_hash_make(const struct community *com)
 {
 	uint32_t *pnt = com->val;
 
+	/* Interned communities never change, see aspath_key_make() */
+	if (com->refcnt)
+		return com->hash;
+
 	return jhash2(pnt, com->size, 0x43ea96c1);
 }
 
@@ -905,6 +911,7 @@ static void *bgp_aggr_community_hash_alloc(void *p)
 	struct community *community = NULL;
 
 	community = community_dup(ref);
+	community->hash = community_hash_make(ref);
 	return community;
 }
 
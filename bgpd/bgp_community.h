@@ -18,6 +18,9 @@ struct community {
 	/* Communities value size.  */
 	int size;
 
+	/* Hash key, only valid while the community is interned (refcnt > 0) */
+	uint32_t hash;
+
 	/* Communities value.  */
 	uint32_t *val;
 
@@ -22,29 +22,31 @@
 #include "bgpd/bgp_advertise.h"
 #include "bgpd/bgp_vty.h"
 
-static void bgp_reuselist_add(struct reuselist *list, struct bgp_damp_info *info)
+static void bgp_reuselist_add(struct reuselist_head *list,
+			      struct bgp_damp_info *info)
 {
 	assert(info);
-	SLIST_INSERT_HEAD(list, info, entry);
+	reuselist_add_head(list, info);
 }
 
-static void bgp_reuselist_del(struct reuselist *list, struct bgp_damp_info *info)
+static void bgp_reuselist_del(struct reuselist_head *list,
+			      struct bgp_damp_info *info)
 {
 	assert(info);
-	SLIST_REMOVE(list, info, bgp_damp_info, entry);
+	reuselist_del(list, info);
 }
 
-static void bgp_reuselist_switch(struct reuselist *source,
+static void bgp_reuselist_switch(struct reuselist_head *source,
 				 struct bgp_damp_info *info,
-				 struct reuselist *target)
+				 struct reuselist_head *target)
 {
 	assert(source && target && info);
-	SLIST_REMOVE(source, info, bgp_damp_info, entry);
-	SLIST_INSERT_HEAD(target, info, entry);
+	reuselist_del(source, info);
+	reuselist_add_head(target, info);
 }
 
 static void bgp_damp_info_unclaim(struct bgp_damp_info *bdi,
-				  struct reuselist *list)
+				  struct reuselist_head *list)
 {
 	assert(bdi && bdi->config);
 	if (bdi->index == BGP_DAMP_NO_REUSE_LIST_INDEX)
@@ -158,8 +160,8 @@ int bgp_damp_decay(time_t tdiff, int penalty, struct bgp_damp_config *bdc)
    is evaluated.  RFC2439 Section 4.8.7.  */
 static void bgp_reuse_timer(struct event *t)
 {
-	struct bgp_damp_info *bdi, *bdi_next;
-	struct reuselist plist;
+	struct bgp_damp_info *bdi;
+	struct reuselist_head plist;
 	struct bgp *bgp;
 	time_t t_now, t_diff;
 	struct bgp_damp_config *bdc = EVENT_ARG(t);
@@ -173,8 +175,8 @@ static void bgp_reuse_timer(struct event *t)
 	/* 1.  save a pointer to the current queue head and zero the list head
 	 * list head entry. */
 	assert(bdc->reuse_offset < bdc->reuse_list_size);
-	plist = bdc->reuse_list[bdc->reuse_offset];
-	SLIST_INIT(&bdc->reuse_list[bdc->reuse_offset]);
+	reuselist_init(&plist);
+	reuselist_swap_all(&plist, &bdc->reuse_list[bdc->reuse_offset]);
 
 	/* 2.  set offset = modulo reuse-list-size ( offset + 1 ), thereby
 	   rotating the circular queue of list-heads.  */
@@ -182,7 +184,7 @@ static void bgp_reuse_timer(struct event *t)
 	assert(bdc->reuse_offset < bdc->reuse_list_size);
 
 	/* 3. if ( the saved list head pointer is non-empty ) */
-	SLIST_FOREACH_SAFE (bdi, &plist, entry, bdi_next) {
+	frr_each_safe (reuselist, &plist, bdi) {
 		bgp = bdi->path->peer->bgp;
 
 		/* Set t-diff = t-now - t-updated.  */
@@ -228,7 +230,8 @@ static void bgp_reuse_timer(struct event *t)
 		}
 	}
 
-	assert(SLIST_EMPTY(&plist));
+	assert(reuselist_count(&plist) == 0);
+	reuselist_fini(&plist);
 }
 
 /* A route becomes unreachable (RFC2439 Section 4.8.2).  */
@@ -365,8 +368,8 @@ int bgp_damp_update(struct bgp_path_info *path, struct bgp_dest *dest,
 	return status;
 }
 
-void bgp_damp_info_free(struct bgp_damp_info *bdi, struct reuselist *list,
-			int withdraw)
+void bgp_damp_info_free(struct bgp_damp_info *bdi,
+			struct reuselist_head *list, int withdraw)
 {
 	assert(bdi);
 
@@ -431,7 +434,11 @@ static void bgp_damp_parameter_set(time_t hlife, unsigned int reuse,
 
 	bdc->reuse_list =
 		XCALLOC(MTYPE_BGP_DAMP_ARRAY,
-			bdc->reuse_list_size * sizeof(struct reuselist));
+			bdc->reuse_list_size * sizeof(struct reuselist_head));
+	for (i = 0; i < bdc->reuse_list_size; i++)
+		reuselist_init(&bdc->reuse_list[i]);
+	reuselist_init(&bdc->no_reuse_list);
+
 	/* Reuse-array computations */
 	bdc->reuse_index = XCALLOC(MTYPE_BGP_DAMP_ARRAY,
 				   sizeof(int) * bdc->reuse_index_size);
@@ -485,13 +492,13 @@ void bgp_damp_info_clean(struct bgp *bgp, struct bgp_damp_config *bdc,
 			 afi_t afi, safi_t safi)
 {
 	struct bgp_damp_info *bdi;
-	struct reuselist *list;
+	struct reuselist_head *list;
 	unsigned int i;
 
 	bdc->reuse_offset = 0;
 	for (i = 0; i < bdc->reuse_list_size; ++i) {
 		list = &bdc->reuse_list[i];
-		while ((bdi = SLIST_FIRST(list)) != NULL) {
+		while ((bdi = reuselist_first(list)) != NULL) {
 			if (bdi->lastrecord == BGP_RECORD_UPDATE) {
 				bgp_aggregate_increment(bgp,
 							bgp_dest_get_prefix(
@@ -505,8 +512,11 @@ void bgp_damp_info_clean(struct bgp *bgp, struct bgp_damp_config *bdc,
 		}
 	}
 
-	while ((bdi = SLIST_FIRST(&bdc->no_reuse_list)) != NULL)
+	/* The list head is only set up once dampening was enabled. */
+	while (reuselist_count(&bdc->no_reuse_list)) {
+		bdi = reuselist_first(&bdc->no_reuse_list);
 		bgp_damp_info_free(bdi, &bdc->no_reuse_list, 1);
+	}
 
 	/* Free decay array */
 	XFREE(MTYPE_BGP_DAMP_ARRAY, bdc->decay_array);
@@ -8,6 +8,8 @@
 
 #include "bgpd/bgp_table.h"
 
+PREDECL_DLIST(reuselist);
+
 /* Structure maintained on a per-route basis. */
 struct bgp_damp_info {
 	/* Figure-of-merit.  */
@@ -39,18 +41,18 @@ struct bgp_damp_info {
 #define BGP_DAMP_NO_REUSE_LIST_INDEX                                           \
 	(-1) /* index for elements on no_reuse_list */
 
+	afi_t afi;
+	safi_t safi;
+
 	/* Last time message type. */
 	uint8_t lastrecord;
 #define BGP_RECORD_UPDATE	1U
 #define BGP_RECORD_WITHDRAW	2U
 
-	afi_t afi;
-	safi_t safi;
-
-	SLIST_ENTRY(bgp_damp_info) entry;
+	struct reuselist_item entry;
 };
 
-SLIST_HEAD(reuselist, bgp_damp_info);
+DECLARE_DLIST(reuselist, struct bgp_damp_info, entry);
 
 /* Specified parameter set configuration. */
 struct bgp_damp_config {
@@ -88,12 +90,12 @@ struct bgp_damp_config {
 	int *reuse_index;
 
 	/* Reuse list array per-set based. */
-	struct reuselist *reuse_list;
+	struct reuselist_head *reuse_list;
 	unsigned int reuse_offset;
 	safi_t safi;
 
 	/* All dampening information which is not on reuse list.  */
-	struct reuselist no_reuse_list;
+	struct reuselist_head no_reuse_list;
 
 	/* Reuse timer thread per-set base. */
 	struct event *t_reuse;
@@ -131,7 +133,7 @@ extern int bgp_damp_withdraw(struct bgp_path_info *path, struct bgp_dest *dest,
 extern int bgp_damp_update(struct bgp_path_info *path, struct bgp_dest *dest,
 			   afi_t afi, safi_t saff);
 extern void bgp_damp_info_free(struct bgp_damp_info *bdi,
-			       struct reuselist *list, int withdraw);
+			       struct reuselist_head *list, int withdraw);
 extern void bgp_damp_info_clean(struct bgp *bgp, struct bgp_damp_config *bdc,
 				afi_t afi, safi_t safi);
 extern void bgp_damp_config_clean(struct bgp_damp_config *bdc);
@@ -297,6 +297,8 @@ struct ecommunity *ecommunity_intern(struct ecommunity *ecom)
 	find = (struct ecommunity *)hash_get(ecomhash, ecom, hash_alloc_intern);
 	if (find != ecom)
 		ecommunity_free(&ecom);
+	else
+		find->hash = ecommunity_hash_make(find);
 
 	find->refcnt++;
 
@@ -334,6 +336,10 @@ unsigned int ecommunity_hash_make(const void *arg)
 	const struct ecommunity *ecom = arg;
 	int size = ecom->size * ecom->unit_size;
 
+	/* Interned communities never change, see aspath_key_make() */
+	if (ecom->refcnt)
+		return ecom->hash;
+
 	return jhash(ecom->val, size, 0x564321ab);
 }
 
@@ -1691,6 +1697,7 @@ static void *bgp_aggr_ecommunty_hash_alloc(void *p)
 	struct ecommunity *ecommunity = NULL;
 
 	ecommunity = ecommunity_dup(ref);
+	ecommunity->hash = ecommunity_hash_make(ref);
 	return ecommunity;
 }
 
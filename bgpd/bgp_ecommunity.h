@@ -131,6 +131,9 @@ struct ecommunity {
 	/* Size of Extended Communities attribute.  */
 	uint32_t size;
 
+	/* Hash key, only valid while interned (refcnt > 0) */
+	uint32_t hash;
+
 	/* Extended Communities value.  */
 	uint8_t *val;
 
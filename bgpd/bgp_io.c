@@ -18,6 +18,8 @@
 #include "stream.h"		// for stream_get_endp, stream_getw_from, str...
 #include "ringbuf.h"		// for ringbuf_remain, ringbuf_peek, ringbuf_...
 #include "frrevent.h"		// for EVENT_OFF, EVENT_ARG, thread...
+#include "vty.h"		// for vty_out
+#include "json.h"		// for json_object_new_object...
 
 #include "bgpd/bgp_io.h"
 #include "bgpd/bgp_debug.h"	// for bgp_debug_neighbor_events, bgp_type_str
@@ -40,11 +42,104 @@ static bool validate_header(struct peer_connection *connection);
 #define BGP_IO_FATAL_ERR (1 << 1) /* some kind of fatal TCP error */
 #define BGP_IO_WORK_FULL_ERR (1 << 2) /* No room in work buffer */
 
+/*
+ * State kept for each I/O pthread. Everything but the connection count is
+ * only touched by the pthread itself; the statistics are read from the main
+ * pthread for show output.
+ */
+struct bgp_io_pthread {
+	/* Number of connections assigned, only used from the main pthread */
+	unsigned int connections;
+
+	/* Have we logged full input queue already */
+	bool ibuf_full_logged;
+
+	/* Read passes, and packets pulled off ibuf_work by them */
+	_Atomic uint64_t reads;
+	_Atomic uint64_t read_packets;
+	_Atomic uint32_t read_packets_max;
+};
+
+static struct bgp_io_pthread bgp_io_pthreads[BGP_IO_PTHREADS_MAX];
+
+#define BGP_IO_PTH(connection) (bgp_pth_io[(connection)->io_pthread])
+
 /* Thread external API ----------------------------------------------------- */
 
+void bgp_io_connection_assign(struct peer_connection *connection)
+{
+	unsigned int i, best = 0;
+
+	/*
+	 * All I/O for a connection happens on one pthread, which keeps
+	 * its packets in order. New connections go to the least loaded one.
+	 */
+	for (i = 1; i < bm->io_pthreads; i++)
+		if (bgp_io_pthreads[i].connections <
+		    bgp_io_pthreads[best].connections)
+			best = i;
+
+	connection->io_pthread = best;
+	bgp_io_pthreads[best].connections++;
+}
+
+void bgp_io_connection_release(struct peer_connection *connection)
+{
+	struct bgp_io_pthread *iop = &bgp_io_pthreads[connection->io_pthread];
+
+	if (iop->connections)
+		iop->connections--;
+}
+
+void bgp_io_show_statistics(struct vty *vty, json_object *json)
+{
+	struct bgp_io_pthread *iop;
+	json_object *json_array = NULL, *json_pth;
+	uint64_t reads, packets;
+	uint32_t packets_max;
+	unsigned int i;
+
+	if (json)
+		json_array = json_object_new_array();
+	else
+		vty_out(vty, "\nI/O pthreads:\n");
+
+	for (i = 0; i < bm->io_pthreads; i++) {
+		iop = &bgp_io_pthreads[i];
+		reads = atomic_load_explicit(&iop->reads, memory_order_relaxed);
+		packets = atomic_load_explicit(&iop->read_packets,
+					       memory_order_relaxed);
+		packets_max = atomic_load_explicit(&iop->read_packets_max,
+						   memory_order_relaxed);
+
+		if (json) {
+			json_pth = json_object_new_object();
+			json_object_string_add(json_pth, "name",
+					       bgp_pth_io[i]->name);
+			json_object_int_add(json_pth, "connections",
+					    iop->connections);
+			json_object_int_add(json_pth, "reads", reads);
+			json_object_int_add(json_pth, "readPackets", packets);
+			json_object_int_add(json_pth, "readPacketsMax",
+					    packets_max);
+			json_object_array_add(json_array, json_pth);
+			continue;
+		}
+
+		vty_out(vty,
+			"  %s: %u connections, %" PRIu64 " reads, %" PRIu64
+			" packets read (%.2f per read, max %u)\n",
+			bgp_pth_io[i]->name, iop->connections, reads, packets,
+			reads ? (double)packets / reads : 0.0, packets_max);
+	}
+
+	if (json)
+		json_object_object_add(json, "ioPthreads", json_array);
+}
+
 void bgp_writes_on(struct peer_connection *connection)
 {
-	struct frr_pthread *fpt = bgp_pth_io;
+	struct frr_pthread *fpt = BGP_IO_PTH(connection);
 
 	assert(fpt->running);
 
@@ -64,7 +159,7 @@ void bgp_writes_on(struct peer_connection *connection)
 void bgp_writes_off(struct peer_connection *connection)
 {
 	struct peer *peer = connection->peer;
-	struct frr_pthread *fpt = bgp_pth_io;
+	struct frr_pthread *fpt = BGP_IO_PTH(connection);
 	assert(fpt->running);
 
 	event_cancel_async(fpt->master, &connection->t_write, NULL);
@@ -75,7 +170,7 @@ void bgp_writes_off(struct peer_connection *connection)
 
 void bgp_reads_on(struct peer_connection *connection)
 {
-	struct frr_pthread *fpt = bgp_pth_io;
+	struct frr_pthread *fpt = BGP_IO_PTH(connection);
 	assert(fpt->running);
 
 	assert(connection->status != Deleted);
@@ -95,7 +190,7 @@ void bgp_reads_on(struct peer_connection *connection)
 
 void bgp_reads_off(struct peer_connection *connection)
 {
-	struct frr_pthread *fpt = bgp_pth_io;
+	struct frr_pthread *fpt = BGP_IO_PTH(connection);
 	assert(fpt->running);
 
 	event_cancel_async(fpt->master, &connection->t_read, NULL);
@@ -112,18 +207,15 @@ void bgp_reads_off(struct peer_connection *connection)
  */
 static void bgp_process_writes(struct event *thread)
 {
-	static struct peer *peer;
 	struct peer_connection *connection = EVENT_ARG(thread);
 	uint16_t status;
 	bool reschedule;
 	bool fatal = false;
 
-	peer = connection->peer;
-
 	if (connection->fd < 0)
 		return;
 
-	struct frr_pthread *fpt = bgp_pth_io;
+	struct frr_pthread *fpt = BGP_IO_PTH(connection);
 
 	frr_with_mutex (&connection->io_mtx) {
 		status = bgp_write(connection);
@@ -219,12 +311,12 @@ static void bgp_process_reads(struct event *thread)
 {
 	/* clang-format off */
 	struct peer_connection *connection = EVENT_ARG(thread);
-	static struct peer *peer;       /* peer to read from */
+	struct peer *peer;              /* peer to read from */
 	uint16_t status;                /* bgp_read status code */
 	bool fatal = false;             /* whether fatal error occurred */
 	bool added_pkt = false;         /* whether we pushed onto ->connection.ibuf */
 	int code = 0;                   /* FSM code if error occurred */
-	static bool ibuf_full_logged;   /* Have we logged full already */
+	uint32_t npkts = 0;             /* packets pulled off ibuf_work */
 	int ret = 1;
 	/* clang-format on */
 
@@ -233,7 +325,8 @@ static void bgp_process_reads(struct event *thread)
 	if (bm->terminating || connection->fd < 0)
 		return;
 
-	struct frr_pthread *fpt = bgp_pth_io;
+	struct frr_pthread *fpt = BGP_IO_PTH(connection);
+	struct bgp_io_pthread *iop = &bgp_io_pthreads[connection->io_pthread];
 
 	frr_with_mutex (&connection->io_mtx) {
 		status = bgp_read(connection, &code);
@@ -263,24 +356,33 @@ static void bgp_process_reads(struct event *thread)
 			break;
 
 		added_pkt = true;
+		npkts++;
 	}
 
+	atomic_fetch_add_explicit(&iop->reads, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&iop->read_packets, npkts,
+				  memory_order_relaxed);
+	if (npkts > atomic_load_explicit(&iop->read_packets_max,
+					 memory_order_relaxed))
+		atomic_store_explicit(&iop->read_packets_max, npkts,
+				      memory_order_relaxed);
+
 	switch (ret) {
 	case -EBADMSG:
 		fatal = true;
 		break;
 	case -ENOMEM:
-		if (!ibuf_full_logged) {
+		if (!iop->ibuf_full_logged) {
 			if (bgp_debug_neighbor_events(peer))
 				zlog_debug(
 					"%s [Event] Peer Input-Queue is full: limit (%u)",
 					peer->host, bm->inq_limit);
 
-			ibuf_full_logged = true;
+			iop->ibuf_full_logged = true;
 		}
 		break;
 	default:
-		ibuf_full_logged = false;
+		iop->ibuf_full_logged = false;
 		break;
 	}
 
@@ -482,7 +584,6 @@ done : {
 	return status;
 }
 
-uint8_t ibuf_scratch[BGP_EXTENDED_MESSAGE_MAX_PACKET_SIZE * BGP_READ_PACKET_MAX];
 /*
  * Reads a chunk of data from peer->connection.fd into
  * peer->connection.ibuf_work.
@@ -492,27 +593,24 @@ uint8_t ibuf_scratch[BGP_EXTENDED_MESSAGE_MAX_PACKET_SIZE * BGP_READ_PACKET_MAX]
  *
  * @return status flag (see top-of-file)
  *
- * PLEASE NOTE:  If we ever transform the bgp_read to be a pthread
- * per peer then we need to rethink the global ibuf_scratch
- * data structure above.
+ * The data is read straight into the free space of ibuf_work, which may
+ * wrap around the end of the ring buffer, hence readv().
  */
 static uint16_t bgp_read(struct peer_connection *connection, int *code_p)
 {
-	size_t readsize; /* how many bytes we want to read */
+	struct iovec iov[2]; /* free space in the work buf */
+	int iovcnt;
 	ssize_t nbytes;  /* how many bytes we actually read */
-	size_t ibuf_work_space; /* space we can read into the work buf */
 	uint16_t status = 0;
 
-	ibuf_work_space = ringbuf_space(connection->ibuf_work);
+	iovcnt = ringbuf_space_iov(connection->ibuf_work, iov);
 
-	if (ibuf_work_space == 0) {
+	if (iovcnt == 0) {
 		SET_FLAG(status, BGP_IO_WORK_FULL_ERR);
 		return status;
 	}
 
-	readsize = MIN(ibuf_work_space, sizeof(ibuf_scratch));
-
-	nbytes = read(connection->fd, ibuf_scratch, readsize);
+	nbytes = readv(connection->fd, iov, iovcnt);
 
 	/* EAGAIN or EWOULDBLOCK; come back later */
 	if (nbytes < 0 && ERRNO_IO_RETRY(errno)) {
@@ -541,8 +639,8 @@ static uint16_t bgp_read(struct peer_connection *connection, int *code_p)
 
 		SET_FLAG(status, BGP_IO_FATAL_ERR);
 	} else {
-		assert(ringbuf_put(connection->ibuf_work, ibuf_scratch,
-				   nbytes) == (size_t)nbytes);
+		assert(ringbuf_commit(connection->ibuf_work, nbytes) ==
+		       (size_t)nbytes);
 	}
 
 	return status;
@@ -13,8 +13,35 @@
 
 #include "bgpd/bgpd.h"
 #include "frr_pthread.h"
+#include "json.h"
 
 struct peer_connection;
+struct vty;
+
+/**
+ * Picks the I/O pthread a new connection is handled by.
+ *
+ * All reads and writes of the connection happen on that pthread for its
+ * whole lifetime. Called from the main pthread only.
+ *
+ * @param connection - the connection being created
+ */
+extern void bgp_io_connection_assign(struct peer_connection *connection);
+
+/**
+ * Releases the I/O pthread assignment of a connection that is being freed.
+ *
+ * @param connection - the connection being freed
+ */
+extern void bgp_io_connection_release(struct peer_connection *connection);
+
+/**
+ * Displays per I/O pthread connection counts and read batching statistics.
+ *
+ * @param vty - where to display the statistics
+ * @param json - if set, statistics are added to it instead
+ */
+extern void bgp_io_show_statistics(struct vty *vty, json_object *json);
 
 /**
  * Start function for write thread.
@@ -13,7 +13,7 @@
 #include "hash.h"		// for hash, hash_clean, hash_create_size...
 #include "log.h"		// for zlog_debug
 #include "memory.h"		// for MTYPE_TMP, XFREE, XCALLOC, XMALLOC
-#include "monotime.h"		// for monotime, monotime_since
+#include "monotime.h"		// for monotime
 
 #include "bgpd/bgpd.h"          // for peer, PEER_EVENT_KEEPALIVES_ON, peer...
 #include "bgpd/bgp_debug.h"	// for bgp_debug_neighbor_events
@@ -25,6 +25,8 @@ DEFINE_MTYPE_STATIC(BGPD, BGP_PKAT, "Peer KeepAlive Timer");
 DEFINE_MTYPE_STATIC(BGPD, BGP_COND, "BGP Peer pthread Conditional");
 DEFINE_MTYPE_STATIC(BGPD, BGP_MUTEX, "BGP Peer pthread Mutex");
 
+PREDECL_HEAP(pkat_heap);
+
 /*
  * Peer KeepAlive Timer.
  * Associates a peer with the time of its last keepalive.
@@ -34,18 +36,46 @@ struct pkat {
 	struct peer *peer;
 	/* absolute time of last keepalive sent */
 	struct timeval last;
+	/* absolute time this peer needs to be looked at again */
+	struct timeval next;
+	/* entry in the heap of peers sorted by next */
+	struct pkat_heap_item heapitem;
 };
 
-/* List of peers we are sending keepalives for, and associated mutex. */
+static int pkat_cmp(const struct pkat *a, const struct pkat *b)
+{
+	if (timercmp(&a->next, &b->next, <))
+		return -1;
+	if (timercmp(&a->next, &b->next, >))
+		return 1;
+	return 0;
+}
+
+DECLARE_HEAP(pkat_heap, struct pkat, heapitem, pkat_cmp);
+
+/*
+ * List of peers we are sending keepalives for, and associated mutex. The
+ * hash is used to find a peer's entry, the heap to find the peers that are
+ * due for a keepalive without visiting all the others.
+ */
 static pthread_mutex_t *peerhash_mtx;
 static pthread_cond_t *peerhash_cond;
 static struct hash *peerhash;
+static struct pkat_heap_head pkat_heap;
+
+/*
+ * How often a peer with a keepalive timer of 0 is looked at again, in case
+ * the timer got set in the meantime.
+ */
+static const struct timeval pkat_recheck = {1, 0};
 
 static struct pkat *pkat_new(struct peer *peer)
 {
-	struct pkat *pkat = XMALLOC(MTYPE_BGP_PKAT, sizeof(struct pkat));
+	struct pkat *pkat = XCALLOC(MTYPE_BGP_PKAT, sizeof(struct pkat));
 	pkat->peer = peer;
 	monotime(&pkat->last);
+	/* due right away, peer_process() works out the real due time */
+	pkat->next = pkat->last;
 	return pkat;
 }
 
@@ -56,8 +86,10 @@ static void pkat_del(void *pkat)
 
 
 /*
- * Callback for hash_iterate. Determines if a peer needs a keepalive and if so,
- * generates and sends it.
+ * Called for a peer that was taken off the top of the heap. Determines if
+ * the peer needs a keepalive and if so, generates and sends it. In either
+ * case the time the peer needs to be looked at again is stored in
+ * pkat->next, and the caller puts the peer back into the heap.
  *
  * For any given peer, if the elapsed time since its last keepalive exceeds its
  * configured keepalive timer, a keepalive is sent to the peer and its
@@ -67,56 +99,41 @@ static void pkat_del(void *pkat)
  * timer was exceeded. Doing this helps alleviate nanosecond sleeps between
  * ticks by grouping together peers who are due for keepalives at roughly the
  * same time. This tolerance value is arbitrarily chosen to be 100ms.
- *
- * In addition, this function calculates the maximum amount of time that the
- * keepalive thread can sleep before another tick needs to take place. This is
- * equivalent to shortest time until a keepalive is due for any one peer.
- *
- * @return maximum time to wait until next update (0 if infinity)
  */
-static void peer_process(struct hash_bucket *hb, void *arg)
-{
-	struct pkat *pkat = hb->data;
-
-	struct timeval *next_update = arg;
-
-	static struct timeval elapsed;  // elapsed time since keepalive
-	static struct timeval ka = {0}; // peer->v_keepalive as a timeval
-	static struct timeval diff;     // ka - elapsed
+static const struct timeval tolerance = {0, 100000};
 
-	static const struct timeval tolerance = {0, 100000};
+static void peer_process(struct pkat *pkat, const struct timeval *now)
+{
+	struct timeval ka = {0}; // peer->v_keepalive as a timeval
+	struct timeval due;      // last + ka
+	struct timeval limit;    // now + tolerance
 
 	uint32_t v_ka = atomic_load_explicit(&pkat->peer->v_keepalive,
 					     memory_order_relaxed);
 
 	/* 0 keepalive timer means no keepalives */
-	if (v_ka == 0)
+	if (v_ka == 0) {
+		timeradd(now, &pkat_recheck, &pkat->next);
 		return;
+	}
 
-	/* calculate elapsed time since last keepalive */
-	monotime_since(&pkat->last, &elapsed);
-
-	/* calculate difference between elapsed time and configured time */
 	ka.tv_sec = v_ka;
-	timersub(&ka, &elapsed, &diff);
+	timeradd(&pkat->last, &ka, &due);
+	timeradd(now, &tolerance, &limit);
 
-	int send_keepalive =
-		elapsed.tv_sec >= ka.tv_sec || timercmp(&diff, &tolerance, <);
-
-	if (send_keepalive) {
-		if (bgp_debug_keepalive(pkat->peer))
-			zlog_debug("%s [FSM] Timer (keepalive timer expire)",
-				   pkat->peer->host);
-
-		bgp_keepalive_send(pkat->peer);
-		monotime(&pkat->last);
-		memset(&elapsed, 0, sizeof(elapsed));
-		diff = ka;
+	/* not due yet, e.g. since the timer was raised or just turned on */
+	if (timercmp(&due, &limit, >)) {
+		pkat->next = due;
+		return;
 	}
 
-	/* if calculated next update for this peer < current delay, use it */
-	if (next_update->tv_sec < 0 || timercmp(&diff, next_update, <))
-		*next_update = diff;
+	if (bgp_debug_keepalive(pkat->peer))
+		zlog_debug("%s [FSM] Timer (keepalive timer expire)",
+			   pkat->peer->host);
+
+	bgp_keepalive_send(pkat->peer);
+	pkat->last = *now;
+	timeradd(now, &ka, &pkat->next);
 }
 
 static bool peer_hash_cmp(const void *f, const void *s)
@@ -136,6 +153,9 @@ static unsigned int peer_hash_key(const void *arg)
 /* Cleanup handler / deinitializer. */
 static void bgp_keepalives_finish(void *arg)
 {
+	while (pkat_heap_pop(&pkat_heap))
+		;
+	pkat_heap_fini(&pkat_heap);
 	hash_clean_and_free(&peerhash, pkat_del);
 
 	pthread_mutex_unlock(peerhash_mtx);
@@ -155,9 +175,9 @@ void *bgp_keepalives_start(void *arg)
 	fpt->master->owner = pthread_self();
 
 	struct timeval currtime = {0, 0};
-	struct timeval aftertime = {0, 0};
-	struct timeval next_update = {0, 0};
+	struct timeval limit = {0, 0};
 	struct timespec next_update_ts = {0, 0};
+	struct pkat *pkat;
 
 	/*
 	 * The RCU mechanism for each pthread is initialized in a "locked"
@@ -189,6 +209,7 @@ void *bgp_keepalives_start(void *arg)
 
 	/* initialize peer hashtable */
 	peerhash = hash_create_size(2048, peer_hash_key, peer_hash_cmp, NULL);
+	pkat_heap_init(&pkat_heap);
 	pthread_mutex_lock(peerhash_mtx);
 
 	/* register cleanup handler */
@@ -208,17 +229,23 @@ void *bgp_keepalives_start(void *arg)
 				pthread_cond_wait(peerhash_cond, peerhash_mtx);
 
 		monotime(&currtime);
+		timeradd(&currtime, &tolerance, &limit);
 
-		next_update.tv_sec = -1;
-
-		hash_iterate(peerhash, peer_process, &next_update);
-		if (next_update.tv_sec == -1)
-			memset(&next_update, 0, sizeof(next_update));
+		/* only the peers that are due are taken off the heap */
+		while ((pkat = pkat_heap_first(&pkat_heap))) {
+			if (timercmp(&pkat->next, &limit, >))
+				break;
 
-		monotime_since(&currtime, &aftertime);
+			pkat_heap_pop(&pkat_heap);
+			peer_process(pkat, &currtime);
+			pkat_heap_add(&pkat_heap, pkat);
+		}
 
-		timeradd(&currtime, &next_update, &next_update);
-		TIMEVAL_TO_TIMESPEC(&next_update, &next_update_ts);
+		pkat = pkat_heap_first(&pkat_heap);
+		if (pkat) {
+			TIMEVAL_TO_TIMESPEC(&pkat->next, &next_update_ts);
+		} else
+			memset(&next_update_ts, 0, sizeof(next_update_ts));
 	}
 
 	/* clean up */
@@ -252,6 +279,7 @@ void bgp_keepalives_on(struct peer_connection *connection)
 		if (!hash_lookup(peerhash, &holder)) {
 			struct pkat *pkat = pkat_new(peer);
 			(void)hash_get(peerhash, pkat, hash_alloc_intern);
+			pkat_heap_add(&pkat_heap, pkat);
 			peer_lock(peer);
 		}
 		SET_FLAG(peer->thread_flags, PEER_THREAD_KEEPALIVES_ON);
@@ -282,6 +310,7 @@ void bgp_keepalives_off(struct peer_connection *connection)
 		holder.peer = peer;
 		struct pkat *res = hash_release(peerhash, &holder);
 		if (res) {
+			pkat_heap_del(&pkat_heap, res);
 			pkat_del(res);
 			peer_unlock(peer);
 		}
@@ -68,8 +68,13 @@ struct lp_chunk {
 	uint32_t nfree;		     /* un-allocated count */
 	uint32_t idx_last_allocated; /* start looking here */
 	bitfield_t allocated_map;
+
+	/* on lp->avail iff nfree > 0 */
+	struct lp_chunk_avail_item avail;
 };
 
+DECLARE_DLIST(lp_chunk_avail, struct lp_chunk, avail);
+
 /*
  * label control block
  */
@@ -172,6 +177,8 @@ static void lp_chunk_free(void *goner)
 {
 	struct lp_chunk *chunk = (struct lp_chunk *)goner;
 
+	if (chunk->nfree)
+		lp_chunk_avail_del(&lp->avail, chunk);
 	bf_free(chunk->allocated_map);
 	XFREE(MTYPE_BGP_LABEL_CHUNK, goner);
 }
@@ -187,6 +194,7 @@ void bgp_lp_init(struct event_loop *master, struct labelpool *pool)
 	lp->inuse = skiplist_new(0, NULL, NULL);
 	lp->chunks = list_new();
 	lp->chunks->del = lp_chunk_free;
+	lp_chunk_avail_init(&lp->avail);
 	lp_fifo_init(&lp->requests);
 	lp->callback_q = work_queue_new(master, "label callbacks");
 
@@ -238,6 +246,7 @@ void bgp_lp_finish(void)
 		bgp_zebra_release_label_range(chunk->first, chunk->last);
 
 	list_delete(&lp->chunks);
+	lp_chunk_avail_fini(&lp->avail);
 
 	while ((lf = lp_fifo_pop(&lp->requests))) {
 		check_bgp_lu_cb_unlock(&lf->lcb);
@@ -261,60 +270,53 @@ void bgp_lp_finish(void)
 
 static mpls_label_t get_label_from_pool(void *labelid)
 {
-	struct listnode *node;
 	struct lp_chunk *chunk;
-	int debug = BGP_DEBUG(labelpool, LABELPOOL);
+	uintptr_t lbl;
+	unsigned int index;
 
 	/*
-	 * Find a free label
+	 * Only chunks with free labels are kept on the avail list, so
+	 * full chunks are never looked at.
 	 */
-	for (ALL_LIST_ELEMENTS_RO(lp->chunks, node, chunk)) {
-		uintptr_t lbl;
-		unsigned int index;
-
-		if (debug)
-			zlog_debug("%s: chunk first=%u last=%u",
-				__func__, chunk->first, chunk->last);
+	chunk = lp_chunk_avail_first(&lp->avail);
+	if (!chunk)
+		return MPLS_LABEL_NONE;
 
-		/*
-		 * don't look in chunks with no available labels
-		 */
-		if (!chunk->nfree)
-			continue;
-
-		/*
-		 * roll through bitfield starting where we stopped
-		 * last time
-		 */
-		index = bf_find_next_clear_bit_wrap(
-			&chunk->allocated_map, chunk->idx_last_allocated + 1,
-			0);
-
-		/*
-		 * since chunk->nfree is non-zero, we should always get
-		 * a valid index
-		 */
-		assert(index != WORD_MAX);
-
-		lbl = chunk->first + index;
-		if (skiplist_insert(lp->inuse, (void *)lbl, labelid)) {
-			/* something is very wrong */
-			zlog_err("%s: unable to insert inuse label %u (id %p)",
-				 __func__, (uint32_t)lbl, labelid);
-			return MPLS_LABEL_NONE;
-		}
+	if (BGP_DEBUG(labelpool, LABELPOOL))
+		zlog_debug("%s: chunk first=%u last=%u nfree=%u", __func__,
+			   chunk->first, chunk->last, chunk->nfree);
 
-		/*
-		 * Success
-		 */
-		bf_set_bit(chunk->allocated_map, index);
-		chunk->idx_last_allocated = index;
-		chunk->nfree -= 1;
+	/*
+	 * roll through bitfield starting where we stopped
+	 * last time
+	 */
+	index = bf_find_next_clear_bit_wrap(&chunk->allocated_map,
+					    chunk->idx_last_allocated + 1, 0);
 
-		return lbl;
+	/*
+	 * since chunk->nfree is non-zero, we should always get
+	 * a valid index
+	 */
+	assert(index != WORD_MAX);
+
+	lbl = chunk->first + index;
+	if (skiplist_insert(lp->inuse, (void *)lbl, labelid)) {
+		/* something is very wrong */
+		zlog_err("%s: unable to insert inuse label %u (id %p)",
+			 __func__, (uint32_t)lbl, labelid);
+		return MPLS_LABEL_NONE;
 	}
 
-	return MPLS_LABEL_NONE;
+	/*
+	 * Success
+	 */
+	bf_set_bit(chunk->allocated_map, index);
+	chunk->idx_last_allocated = index;
+	chunk->nfree -= 1;
+	if (!chunk->nfree)
+		lp_chunk_avail_del(&lp->avail, chunk);
+
+	return lbl;
 }
 
 /*
@@ -498,6 +500,9 @@ void bgp_lp_release(
 						     index));
 				bf_release_index(chunk->allocated_map, index);
 				chunk->nfree += 1;
+				if (chunk->nfree == 1)
+					lp_chunk_avail_add_tail(&lp->avail,
+								chunk);
 				deallocated = true;
 				break;
 			}
@@ -616,9 +621,10 @@ void bgp_lp_event_chunk(uint32_t first, uint32_t last)
 
 	/*
 	 * Optimize for allocation by adding the new (presumably larger)
-	 * chunk at the head of the list so it is examined first.
+	 * chunk at the head of the lists so it is examined first.
 	 */
 	listnode_add_head(lp->chunks, chunk);
+	lp_chunk_avail_add_head(&lp->avail, chunk);
 
 	lp->pending_count -= labelcount;
 }
@@ -1335,8 +1341,8 @@ static void labelpool_test_event_handler(struct event *thread)
 	}
 
 	if (tcb->request_count < tcb->request_maximum)
-		thread_add_event(bm->master, labelpool_test_event_handler, NULL,
-				 0, &tcb->event_thread);
+		event_add_event(bm->master, labelpool_test_event_handler, NULL,
+				0, &tcb->event_thread);
 }
 
 static void lptest_stop(void)
@@ -1414,8 +1420,8 @@ static int lptest_start(struct vty *vty)
 	tcb->labels = skiplist_new(0, NULL, NULL);
 	tcb->timestamps_alloc = skiplist_new(0, NULL, NULL);
 	tcb->timestamps_dealloc = skiplist_new(0, NULL, NULL);
-	thread_add_event(bm->master, labelpool_test_event_handler, NULL, 0,
-			 &tcb->event_thread);
+	event_add_event(bm->master, labelpool_test_event_handler, NULL, 0,
+			&tcb->event_thread);
 	monotime(&tcb->starttime);
 
 	skiplist_insert(lp_tests, (void *)(uintptr_t)tcb->generation, tcb);
@@ -1470,18 +1476,34 @@ static void lptest_print_stats(struct vty *vty, struct lp_test *tcb)
 		void *cursor;
 
 		float elapsed;
+		float prev_elapsed = 0;
+		uintptr_t prev_count = 0;
 
-		vty_out(vty, "%10s %10s\n", "Count", "Seconds");
+		vty_out(vty, "%10s %10s %12s\n", "Count", "Seconds",
+			"Labels/sec");
 
 		cursor = NULL;
 		while (!skiplist_next(tcb->timestamps_alloc, &Key, &Value,
 				      &cursor)) {
+			float rate = 0;
 
 			elapsed = ((float)(uintptr_t)Value) / 1000;
 
-			vty_out(vty, "%10llu %10.3f\n",
-				(unsigned long long)(uintptr_t)Key, elapsed);
+			/* throughput over the last timestamp interval */
+			if (elapsed > prev_elapsed)
+				rate = ((uintptr_t)Key - prev_count) /
+				       (elapsed - prev_elapsed);
+
+			vty_out(vty, "%10llu %10.3f %12.0f\n",
+				(unsigned long long)(uintptr_t)Key, elapsed,
+				rate);
+
+			prev_count = (uintptr_t)Key;
+			prev_elapsed = elapsed;
 		}
+		if (prev_elapsed > 0)
+			vty_out(vty, "Average: %.0f labels/sec\n",
+				prev_count / prev_elapsed);
 		vty_out(vty, "\n");
 	}
 }
@@ -21,11 +21,13 @@
 #define LP_TYPE_BGP_L3VPN_BIND 0x00000004
 
 PREDECL_LIST(lp_fifo);
+PREDECL_DLIST(lp_chunk_avail);
 
 struct labelpool {
 	struct skiplist		*ledger;	/* all requests */
 	struct skiplist		*inuse;		/* individual labels */
 	struct list		*chunks;	/* granted by zebra */
+	struct lp_chunk_avail_head avail;	/* chunks with free labels */
 	struct lp_fifo_head	requests;	/* blocked on zebra */
 	struct work_queue	*callback_q;
 	uint32_t		pending_count;	/* requested from zebra */
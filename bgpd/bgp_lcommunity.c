@@ -260,6 +260,8 @@ struct lcommunity *lcommunity_intern(struct lcommunity *lcom)
 
 	if (find != lcom)
 		lcommunity_free(&lcom);
+	else
+		find->hash = lcommunity_hash_make(find);
 
 	find->refcnt++;
 
@@ -312,6 +314,10 @@ unsigned int lcommunity_hash_make(const void *arg)
 	const struct lcommunity *lcom = arg;
 	int size = lcom_length(lcom);
 
+	/* Interned communities never change, see aspath_key_make() */
+	if (lcom->refcnt)
+		return lcom->hash;
+
 	return jhash(lcom->val, size, 0xab125423);
 }
 
@@ -537,6 +543,7 @@ static void *bgp_aggr_lcommunty_hash_alloc(void *p)
 	struct lcommunity *lcommunity = NULL;
 
 	lcommunity = lcommunity_dup(ref);
+	lcommunity->hash = lcommunity_hash_make(ref);
 	return lcommunity;
 }
 
@@ -22,6 +22,9 @@ struct lcommunity {
 	/* Size of Extended Communities attribute.  */
 	int size;
 
+	/* Hash key, only valid while interned (refcnt > 0) */
+	uint32_t hash;
+
 	/* Large Communities value.  */
 	uint8_t *val;
 
@@ -73,6 +73,7 @@ static const struct option longopts[] = {
 	{ "no_zebra", no_argument, NULL, 'Z' },
 	{ "socket_size", required_argument, NULL, 's' },
 	{ "v6-with-v4-nexthops", no_argument, NULL, 'v' },
+	{ "io-threads", required_argument, NULL, 'T' },
 	{ 0 }
 };
 
@@ -422,6 +423,7 @@ int main(int argc, char **argv)
 	int skip_runas = 0;
 	int instance = 0;
 	int buffer_size = BGP_SOCKET_SNDBUF_SIZE;
+	int io_pthreads = 1;
 	char *address;
 	struct listnode *node;
 
@@ -437,7 +439,8 @@ int main(int argc, char **argv)
 		    "  -e, --ecmp               Specify ECMP to use.\n"
 		    "  -I, --int_num            Set instance number (label-manager)\n"
 		    "  -s, --socket_size        Set BGP peer socket send buffer size\n"
-		    "    , --v6-with-v4-nexthop Allow BGP to form v6 neighbors using v4 nexthops\n");
+		    "    , --v6-with-v4-nexthop Allow BGP to form v6 neighbors using v4 nexthops\n"
+		    "    , --io-threads         Number of pthreads for peer socket I/O\n");
 
 	/* Command line argument treatment. */
 	while (1) {
@@ -502,6 +505,15 @@ int main(int argc, char **argv)
 		case 'v':
 			bm->v6_with_v4_nexthops = true;
 			break;
+		case 'T':
+			io_pthreads = atoi(optarg);
+			if (io_pthreads < 1 || io_pthreads > BGP_IO_PTHREADS_MAX) {
+				fprintf(stderr,
+					"Number of I/O threads must be between 1 and %u\n",
+					BGP_IO_PTHREADS_MAX);
+				return 1;
+			}
+			break;
 		default:
 			frr_help_exit(1);
 		}
@@ -512,6 +524,7 @@ int main(int argc, char **argv)
 	/* BGP master init. */
 	bgp_master_init(frr_init(), buffer_size, addresses);
 	bm->port = bgp_port;
+	bm->io_pthreads = io_pthreads;
 	if (bgp_port == 0)
 		bgp_option_set(BGP_OPT_NO_LISTEN);
 	if (no_fib_flag || no_zebra_flag)
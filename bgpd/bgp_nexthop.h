@@ -23,6 +23,7 @@
 #define BGP_MP_NEXTHOP_FAMILY NEXTHOP_FAMILY
 
 PREDECL_RBTREE_UNIQ(bgp_nexthop_cache);
+PREDECL_DLIST(bgp_nht_pending);
 
 /* BGP nexthop cache value structure. */
 struct bgp_nexthop_cache {
@@ -34,6 +35,9 @@ struct bgp_nexthop_cache {
 	/* RB-tree entry. */
 	struct bgp_nexthop_cache_item entry;
 
+	/* Entry on the list of nexthops waiting for evaluate_paths(). */
+	struct bgp_nht_pending_item pending;
+
 	/* IGP route's metric. */
 	uint32_t metric;
 
@@ -101,6 +105,7 @@ extern int bgp_nexthop_cache_compare(const struct bgp_nexthop_cache *a,
 				     const struct bgp_nexthop_cache *b);
 DECLARE_RBTREE_UNIQ(bgp_nexthop_cache, struct bgp_nexthop_cache, entry,
 		    bgp_nexthop_cache_compare);
+DECLARE_DLIST(bgp_nht_pending, struct bgp_nexthop_cache, pending);
 
 /* Own tunnel-ip address structure */
 struct tip_addr {
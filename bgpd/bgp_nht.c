@@ -41,6 +41,16 @@ static void unregister_zebra_rnh(struct bgp_nexthop_cache *bnc);
 static int make_prefix(int afi, struct bgp_path_info *pi, struct prefix *p);
 static void bgp_nht_ifp_initial(struct event *thread);
 
+/*
+ * Nexthops updated by zebra whose paths still need evaluate_paths().
+ * zebra sends nexthop updates in bursts (an IGP change may move thousands
+ * of nexthops at once), so the re-evaluation is done in a single pass after
+ * the burst has been read instead of once per message.
+ */
+static struct bgp_nht_pending_head bgp_nht_pending =
+	INIT_DLIST(bgp_nht_pending);
+static struct event *t_bgp_nht_pending;
+
 static int bgp_isvalid_nexthop(struct bgp_nexthop_cache *bnc)
 {
 	return (bgp_zebra_num_connects() == 0
@@ -569,6 +579,32 @@ void bgp_delete_connected_nexthop(afi_t afi, struct peer *peer)
 	}
 }
 
+static void bgp_nht_evaluate_pending(struct event *thread)
+{
+	struct bgp_nexthop_cache *bnc;
+
+	/* evaluate_paths() may free other pending entries, they unlink
+	 * themselves in bnc_free() so popping one at a time is safe.
+	 */
+	while ((bnc = bgp_nht_pending_pop(&bgp_nht_pending)))
+		evaluate_paths(bnc);
+}
+
+static void bgp_nht_evaluate_defer(struct bgp_nexthop_cache *bnc)
+{
+	if (!bgp_nht_pending_anywhere(bnc))
+		bgp_nht_pending_add_tail(&bgp_nht_pending, bnc);
+
+	event_add_event(bm->master, bgp_nht_evaluate_pending, NULL, 0,
+			&t_bgp_nht_pending);
+}
+
+void bgp_nht_evaluate_cancel(struct bgp_nexthop_cache *bnc)
+{
+	if (bgp_nht_pending_anywhere(bnc))
+		bgp_nht_pending_del(&bgp_nht_pending, bnc);
+}
+
 static void bgp_process_nexthop_update(struct bgp_nexthop_cache *bnc,
 				       struct zapi_route *nhr,
 				       bool import_check)
@@ -581,7 +617,13 @@ static void bgp_process_nexthop_update(struct bgp_nexthop_cache *bnc,
 	bool evpn_resolved = false;
 
 	bnc->last_update = monotime(NULL);
-	bnc->change_flags = 0;
+
+	/*
+	 * If an earlier update is still waiting to be evaluated, keep its
+	 * change flags; evaluate_paths() clears them once it has run.
+	 */
+	if (!bgp_nht_pending_anywhere(bnc))
+		bnc->change_flags = 0;
 
 	/* debug print the input */
 	if (BGP_DEBUG(nht, NHT)) {
@@ -739,7 +781,13 @@ static void bgp_process_nexthop_update(struct bgp_nexthop_cache *bnc,
 		bnc->nexthop = NULL;
 	}
 
-	evaluate_paths(bnc);
+	/* The caller leaks static routes right after an import check update,
+	 * so those are evaluated immediately.
+	 */
+	if (import_check)
+		evaluate_paths(bnc);
+	else
+		bgp_nht_evaluate_defer(bnc);
 }
 
 static void bgp_nht_ifp_table_handle(struct bgp *bgp,
@@ -1240,6 +1288,9 @@ void evaluate_paths(struct bgp_nexthop_cache *bnc)
 	struct bgp *bgp_path;
 	const struct prefix *p;
 
+	/* Covers any deferred evaluation that is still pending */
+	bgp_nht_evaluate_cancel(bnc);
+
 	if (BGP_DEBUG(nht, NHT)) {
 		char bnc_buf[BNC_FLAG_DUMP_SIZE];
 		char chg_buf[BNC_FLAG_DUMP_SIZE];
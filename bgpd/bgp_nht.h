@@ -79,6 +79,12 @@ extern void bgp_nht_reg_enhe_cap_intfs(struct peer *peer);
 extern void bgp_nht_dereg_enhe_cap_intfs(struct peer *peer);
 extern void evaluate_paths(struct bgp_nexthop_cache *bnc);
 
+/**
+ * bgp_nht_evaluate_cancel() - Drop a pending deferred evaluation of the
+ *  paths using this nexthop, e.g. because it is being freed.
+ */
+extern void bgp_nht_evaluate_cancel(struct bgp_nexthop_cache *bnc);
+
 extern void bgp_nht_ifp_up(struct interface *ifp);
 extern void bgp_nht_ifp_down(struct interface *ifp);
 
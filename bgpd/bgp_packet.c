@@ -486,6 +486,8 @@ void bgp_generate_updgrp_packets(struct event *thread)
 		return;
 	}
 
+	updgrp_packet_run++;
+
 	do {
 		enum bgp_af_index index;
 
@@ -621,7 +623,11 @@ void bgp_keepalive_send(struct peer *peer)
 {
 	struct stream *s;
 
-	s = stream_new(BGP_STANDARD_MESSAGE_MAX_PACKET_SIZE);
+	/*
+	 * A keepalive is only the header, don't allocate a full message
+	 * buffer for every peer on every keepalive tick.
+	 */
+	s = stream_new(BGP_MSG_KEEPALIVE_MIN_SIZE);
 
 	/* Make keepalive packet. */
 	bgp_packet_set_marker(s, BGP_MSG_KEEPALIVE);
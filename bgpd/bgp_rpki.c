@@ -54,6 +54,11 @@ DEFINE_MTYPE_STATIC(BGPD, BGP_RPKI_REVALIDATE, "BGP RPKI Revalidation");
 
 #define STR_SEPARATOR 10
 
+/* ROA updates read from the rtrlib sync socket per wakeup */
+#define RPKI_SYNC_BATCH 1000
+/* Changed ROA prefixes revalidated per event */
+#define RPKI_REVALIDATE_BATCH 100
+
 #define POLLING_PERIOD_DEFAULT 3600
 #define EXPIRE_INTERVAL_DEFAULT 7200
 #define RETRY_INTERVAL_DEFAULT 600
@@ -93,6 +98,8 @@ struct rpki_for_each_record_arg {
 	enum asnotation_mode asnotation;
 };
 
+PREDECL_HASH(rpki_revalidate);
+
 struct rpki_vrf {
 	struct rtr_mgr_config *rtr_config;
 	struct list *cache_list;
@@ -108,6 +115,16 @@ struct rpki_vrf {
 	char *vrfname;
 	struct event *t_rpki_sync;
 
+	/* ROA prefixes changed by the cache, waiting to be revalidated */
+	struct rpki_revalidate_head revalidate_pending;
+	struct event *t_revalidate;
+
+	/* Revalidation statistics */
+	uint64_t roa_updates;
+	uint64_t revalidated_prefixes;
+	uint64_t revalidated_dests;
+	uint64_t revalidated_all;
+
 	QOBJ_FIELDS;
 };
 
@@ -556,42 +573,128 @@ static void pfx_record_to_prefix(struct pfx_record *record,
 	}
 }
 
+/*
+ * A ROA prefix changed by the cache. A burst of ROA updates often carries
+ * several records for the same prefix (one per origin AS, or a withdraw
+ * followed by an announce), so pending prefixes are kept in a hash and
+ * each affected part of the RIB is only walked once.
+ */
 struct rpki_revalidate_prefix {
-	struct bgp *bgp;
 	struct prefix prefix;
-	afi_t afi;
-	safi_t safi;
+
+	struct rpki_revalidate_item item;
 };
 
-static void rpki_revalidate_prefix(struct event *thread)
+static int rpki_revalidate_cmp(const struct rpki_revalidate_prefix *a,
+			       const struct rpki_revalidate_prefix *b)
+{
+	return prefix_cmp(&a->prefix, &b->prefix);
+}
+
+static uint32_t rpki_revalidate_hash(const struct rpki_revalidate_prefix *rrp)
+{
+	return prefix_hash_key(&rrp->prefix);
+}
+
+DECLARE_HASH(rpki_revalidate, struct rpki_revalidate_prefix, item,
+	     rpki_revalidate_cmp, rpki_revalidate_hash);
+
+static void rpki_revalidate_flush(struct rpki_vrf *rpki_vrf)
+{
+	struct rpki_revalidate_prefix *rrp;
+
+	EVENT_OFF(rpki_vrf->t_revalidate);
+
+	while ((rrp = rpki_revalidate_pop(&rpki_vrf->revalidate_pending)))
+		XFREE(MTYPE_BGP_RPKI_REVALIDATE, rrp);
+}
+
+static uint64_t rpki_revalidate_table(struct bgp_table *table,
+				      const struct prefix *prefix, afi_t afi,
+				      safi_t safi)
 {
-	struct rpki_revalidate_prefix *rrp = EVENT_ARG(thread);
 	struct bgp_dest *match, *node;
+	uint64_t count = 0;
 
-	match = bgp_table_subtree_lookup(rrp->bgp->rib[rrp->afi][rrp->safi],
-					 &rrp->prefix);
+	match = bgp_table_subtree_lookup(table, prefix);
 
 	node = match;
 
 	while (node) {
 		if (bgp_dest_has_bgp_path_info_data(node)) {
-			revalidate_bgp_node(node, rrp->afi, rrp->safi);
+			revalidate_bgp_node(node, afi, safi);
+			count++;
 		}
 
 		node = bgp_route_next_until(node, match);
 	}
 
-	XFREE(MTYPE_BGP_RPKI_REVALIDATE, rrp);
+	return count;
 }
 
-static void bgpd_sync_callback(struct event *thread)
+static void rpki_revalidate_pending(struct event *thread)
 {
+	struct rpki_vrf *rpki_vrf = EVENT_ARG(thread);
+	struct rpki_revalidate_prefix *rrp;
 	struct bgp *bgp;
 	struct listnode *node;
-	struct prefix prefix;
+	struct vrf *vrf = NULL;
+	unsigned int count;
+
+	if (rpki_vrf->vrfname) {
+		vrf = vrf_lookup_by_name(rpki_vrf->vrfname);
+		if (!vrf) {
+			zlog_err("%s(): vrf for rpki %s not found", __func__,
+				 rpki_vrf->vrfname);
+			rpki_revalidate_flush(rpki_vrf);
+			return;
+		}
+	}
+
+	for (count = 0; count < RPKI_REVALIDATE_BATCH; count++) {
+		afi_t afi;
+		safi_t safi;
+
+		rrp = rpki_revalidate_pop(&rpki_vrf->revalidate_pending);
+		if (!rrp)
+			break;
+
+		afi = family2afi(rrp->prefix.family);
+
+		for (ALL_LIST_ELEMENTS_RO(bm->bgp, node, bgp)) {
+			if (!vrf && bgp->vrf_id != VRF_DEFAULT)
+				continue;
+			if (vrf && bgp->vrf_id != vrf->vrf_id)
+				continue;
+
+			for (safi = SAFI_UNICAST; safi < SAFI_MAX; safi++) {
+				struct bgp_table *table = bgp->rib[afi][safi];
+
+				if (!table)
+					continue;
+
+				rpki_vrf->revalidated_dests +=
+					rpki_revalidate_table(table,
+							      &rrp->prefix, afi,
+							      safi);
+			}
+		}
+
+		rpki_vrf->revalidated_prefixes++;
+		XFREE(MTYPE_BGP_RPKI_REVALIDATE, rrp);
+	}
+
+	if (rpki_revalidate_count(&rpki_vrf->revalidate_pending))
+		event_add_event(bm->master, rpki_revalidate_pending, rpki_vrf,
+				0, &rpki_vrf->t_revalidate);
+}
+
+static void bgpd_sync_callback(struct event *thread)
+{
 	struct pfx_record rec;
 	struct rpki_vrf *rpki_vrf = EVENT_ARG(thread);
-	struct vrf *vrf = NULL;
+	struct rpki_revalidate_prefix *rrp, lookup;
+	unsigned int count;
 
 	event_add_read(bm->master, bgpd_sync_callback, rpki_vrf,
 		       rpki_vrf->rpki_sync_socket_bgpd, NULL);
@@ -604,53 +707,43 @@ static void bgpd_sync_callback(struct event *thread)
 
 		atomic_store_explicit(&rpki_vrf->rtr_update_overflow, 0,
 				      memory_order_seq_cst);
-		revalidate_all_routes(rpki_vrf);
-		return;
-	}
 
-	int retval = read(rpki_vrf->rpki_sync_socket_bgpd, &rec,
-			  sizeof(struct pfx_record));
-	if (retval != sizeof(struct pfx_record)) {
-		RPKI_DEBUG("Could not read from rpki_sync_socket_bgpd");
+		/* Everything is revalidated, nothing left to do per prefix */
+		rpki_revalidate_flush(rpki_vrf);
+		rpki_vrf->revalidated_all++;
+		revalidate_all_routes(rpki_vrf);
 		return;
 	}
-	pfx_record_to_prefix(&rec, &prefix);
 
-	afi_t afi = (rec.prefix.ver == LRTR_IPV4) ? AFI_IP : AFI_IP6;
+	/*
+	 * Collect a batch of updates, the read event stays armed for
+	 * whatever is left in the socket.
+	 */
+	for (count = 0; count < RPKI_SYNC_BATCH; count++) {
+		int retval = read(rpki_vrf->rpki_sync_socket_bgpd, &rec,
+				  sizeof(struct pfx_record));
 
-	if (rpki_vrf->vrfname) {
-		vrf = vrf_lookup_by_name(rpki_vrf->vrfname);
-		if (!vrf) {
-			zlog_err("%s(): vrf for rpki %s not found", __func__,
-				 rpki_vrf->vrfname);
-			return;
+		if (retval != sizeof(struct pfx_record)) {
+			if (count == 0)
+				RPKI_DEBUG("Could not read from rpki_sync_socket_bgpd");
+			break;
 		}
-	}
 
-	for (ALL_LIST_ELEMENTS_RO(bm->bgp, node, bgp)) {
-		safi_t safi;
+		rpki_vrf->roa_updates++;
 
-		if (!vrf && bgp->vrf_id != VRF_DEFAULT)
+		memset(&lookup, 0, sizeof(lookup));
+		pfx_record_to_prefix(&rec, &lookup.prefix);
+		if (rpki_revalidate_find(&rpki_vrf->revalidate_pending, &lookup))
 			continue;
-		if (vrf && bgp->vrf_id != vrf->vrf_id)
-			continue;
-
-		for (safi = SAFI_UNICAST; safi < SAFI_MAX; safi++) {
-			struct bgp_table *table = bgp->rib[afi][safi];
-			struct rpki_revalidate_prefix *rrp;
 
-			if (!table)
-				continue;
-
-			rrp = XCALLOC(MTYPE_BGP_RPKI_REVALIDATE, sizeof(*rrp));
-			rrp->bgp = bgp;
-			rrp->prefix = prefix;
-			rrp->afi = afi;
-			rrp->safi = safi;
-			event_add_event(bm->master, rpki_revalidate_prefix, rrp,
-					0, &bgp->t_revalidate[afi][safi]);
-		}
+		rrp = XCALLOC(MTYPE_BGP_RPKI_REVALIDATE, sizeof(*rrp));
+		rrp->prefix = lookup.prefix;
+		rpki_revalidate_add(&rpki_vrf->revalidate_pending, rrp);
 	}
+
+	if (rpki_revalidate_count(&rpki_vrf->revalidate_pending))
+		event_add_event(bm->master, rpki_revalidate_pending, rpki_vrf,
+				0, &rpki_vrf->t_revalidate);
 }
 
 static void revalidate_bgp_node(struct bgp_dest *bgp_dest, afi_t afi,
@@ -844,6 +937,7 @@ static struct rpki_vrf *bgp_rpki_allocate(const char *vrfname)
 	rpki_vrf->polling_period = POLLING_PERIOD_DEFAULT;
 	rpki_vrf->expire_interval = EXPIRE_INTERVAL_DEFAULT;
 	rpki_vrf->retry_interval = RETRY_INTERVAL_DEFAULT;
+	rpki_revalidate_init(&rpki_vrf->revalidate_pending);
 
 	if (vrfname && !strmatch(vrfname, VRF_DEFAULT_NAME))
 		rpki_vrf->vrfname = XSTRDUP(MTYPE_BGP_RPKI_CACHE, vrfname);
@@ -874,6 +968,9 @@ static int bgp_rpki_fini(void)
 		stop(rpki_vrf);
 		list_delete(&rpki_vrf->cache_list);
 
+		rpki_revalidate_flush(rpki_vrf);
+		rpki_revalidate_fini(&rpki_vrf->revalidate_pending);
+
 		close(rpki_vrf->rpki_sync_socket_rtr);
 		close(rpki_vrf->rpki_sync_socket_bgpd);
 
@@ -2608,8 +2705,23 @@ DEFPY (show_rpki_cache_connection,
 		}
 	}
 
-	if (json)
+	if (!json) {
+		vty_out(vty,
+			"ROA updates: %" PRIu64 ", prefixes revalidated: %" PRIu64
+			", destinations revalidated: %" PRIu64
+			", full revalidations: %" PRIu64 "\n",
+			rpki_vrf->roa_updates, rpki_vrf->revalidated_prefixes,
+			rpki_vrf->revalidated_dests, rpki_vrf->revalidated_all);
+	} else {
+		json_object_int_add(json, "roaUpdates", rpki_vrf->roa_updates);
+		json_object_int_add(json, "revalidatedPrefixes",
+				    rpki_vrf->revalidated_prefixes);
+		json_object_int_add(json, "revalidatedDestinations",
+				    rpki_vrf->revalidated_dests);
+		json_object_int_add(json, "fullRevalidations",
+				    rpki_vrf->revalidated_all);
 		vty_json(vty, json);
+	}
 
 	return CMD_SUCCESS;
 }
@@ -1126,6 +1126,7 @@ static void update_subgroup_delete(struct update_subgroup *subgrp)
 
 	bpacket_queue_cleanup(SUBGRP_PKTQ(subgrp));
 	subgroup_clear_table(subgrp);
+	subgroup_attr_cache_clear(subgrp);
 
 	sync_delete(subgrp);
 
@@ -1767,6 +1768,57 @@ void update_group_policy_update(struct bgp *bgp, enum bgp_policy_type ptype,
 	update_group_walk(bgp, updgrp_policy_update_walkcb, &ctx);
 }
 
+/*
+ * update_subgroup_find_split
+ *
+ * Look for a subgroup in the given update group that an earlier peer
+ * was split into from 'old_subgrp', and whose adj-out is still an exact
+ * copy of the one in 'old_subgrp'. Peers that move to another update
+ * group together (e.g. after a shared policy change) can then all join
+ * that subgroup instead of each cloning the adj-out of the old subgroup.
+ */
+static struct update_subgroup *
+update_subgroup_find_split(struct update_group *updgrp,
+			   struct update_subgroup *old_subgrp,
+			   struct peer_af *paf)
+{
+	struct update_subgroup *subgrp;
+
+	/*
+	 * The peer must not have anything outstanding that is not yet
+	 * reflected in the adj-out of the old subgroup.
+	 */
+	if (paf->next_pkt_to_send && paf->next_pkt_to_send->buffer)
+		return NULL;
+
+	if (!advertise_list_is_empty(old_subgrp))
+		return NULL;
+
+	UPDGRP_FOREACH_SUBGRP (updgrp, subgrp) {
+		if (subgrp->split_from.update_group_id !=
+			    old_subgrp->update_group->id ||
+		    subgrp->split_from.subgroup_id != old_subgrp->id)
+			continue;
+
+		if (subgrp->split_from.adj_version != old_subgrp->adj_version ||
+		    subgrp->split_from.own_adj_version != subgrp->adj_version)
+			continue;
+
+		if (!update_subgroup_needs_refresh(subgrp) ||
+		    subgrp->version != old_subgrp->version ||
+		    subgrp->sflags != old_subgrp->sflags)
+			continue;
+
+		if (!bpacket_queue_is_empty(SUBGRP_PKTQ(subgrp)) ||
+		    !advertise_list_is_empty(subgrp))
+			continue;
+
+		return subgrp;
+	}
+
+	return NULL;
+}
+
 /*
  * update_subgroup_split_peer
  *
@@ -1825,6 +1877,30 @@ void update_subgroup_split_peer(struct peer_af *paf,
 		return;
 	}
 
+	/*
+	 * If another peer of the old subgroup was already moved to this
+	 * update group and nothing changed since, join it instead of
+	 * cloning the adj-out again. The subgroup still has a refresh
+	 * pending, which covers this peer as well.
+	 */
+	if (updgrp != old_subgrp->update_group) {
+		subgrp = update_subgroup_find_split(updgrp, old_subgrp, paf);
+		if (subgrp) {
+			if (BGP_DEBUG(update_groups, UPDATE_GROUPS))
+				zlog_debug("u%" PRIu64 ":s%" PRIu64" peer %s split and joined u%" PRIu64":s%" PRIu64,
+					   old_subgrp->update_group->id,
+					   old_subgrp->id, paf->peer->host,
+					   updgrp->id, subgrp->id);
+
+			SUBGRP_INCR_STAT(old_subgrp, split_events);
+
+			/* May free or merge old_subgrp */
+			update_subgroup_remove_peer(old_subgrp, paf);
+			update_subgroup_add_peer(subgrp, paf, 0);
+			return;
+		}
+	}
+
 	/*
 	 * Create a new subgroup under the specified update group, and copy
 	 * over relevant state to it.
@@ -1841,6 +1917,9 @@ void update_subgroup_split_peer(struct peer_af *paf,
 	update_subgroup_copy_adj_out(paf->subgroup, subgrp);
 	update_subgroup_copy_packets(subgrp, paf->next_pkt_to_send);
 
+	subgrp->split_from.adj_version = old_subgrp->adj_version;
+	subgrp->split_from.own_adj_version = subgrp->adj_version;
+
 	if (BGP_DEBUG(update_groups, UPDATE_GROUPS))
 		zlog_debug("u%" PRIu64 ":s%" PRIu64" peer %s split and moved into u%" PRIu64":s%" PRIu64,
 			   paf->subgroup->update_group->id, paf->subgroup->id,
@@ -195,6 +195,22 @@ struct update_subgroup {
 	/* announcement attribute hash */
 	struct hash *hash;
 
+	/*
+	 * Path attributes as encoded for the last UPDATE built by this
+	 * subgroup. Reused for the following UPDATEs carrying the same
+	 * attributes, as long as they are built within the same packet
+	 * generation run (see updgrp_packet_run).
+	 */
+	struct {
+		struct stream *s;
+		struct attr *attr;
+		struct peer *peer;
+		struct peer *from;
+		size_t start;
+		uint64_t run;
+		struct bpacket_attr_vec_arr vecarr;
+	} attr_cache;
+
 	struct event *t_coalesce;
 	uint32_t v_coalesce;
 
@@ -211,11 +227,15 @@ struct update_subgroup {
 	/*
 	 * Identifying information about the subgroup that this subgroup was
 	 * split
-	 * from, if any.
+	 * from, if any. The adj versions of both subgroups are recorded
+	 * right after the adj-out was copied, so that a later peer leaving
+	 * the same subgroup can tell whether the copy is still identical.
 	 */
 	struct {
 		uint64_t update_group_id;
 		uint64_t subgroup_id;
+		uint64_t adj_version;
+		uint64_t own_adj_version;
 	} split_from;
 
 	uint32_t join_events;
@@ -397,7 +417,9 @@ extern void bpacket_add_peer(struct bpacket *pkt, struct peer_af *paf);
 unsigned int bpacket_queue_virtual_length(struct peer_af *paf);
 extern void bpacket_queue_show_vty(struct bpacket_queue *q, struct vty *vty);
 bool subgroup_packets_to_build(struct update_subgroup *subgrp);
+extern uint64_t updgrp_packet_run;
 extern struct bpacket *subgroup_update_packet(struct update_subgroup *s);
+extern void subgroup_attr_cache_clear(struct update_subgroup *subgrp);
 extern struct bpacket *subgroup_withdraw_packet(struct update_subgroup *s);
 extern struct stream *bpacket_reformat_for_peer(struct bpacket *pkt,
 						struct peer_af *paf);
@@ -76,12 +76,45 @@ static inline struct bgp_adj_out *adj_lookup(struct bgp_dest *dest,
 	return RB_FIND(bgp_adj_out_rb, &dest->adj_out, &lookup);
 }
 
+/*
+ * adj-outs are ordered by subgroup first, so the entries of one subgroup
+ * are contiguous on the dest: find the first one instead of scanning the
+ * adj-outs of every other subgroup as well.
+ */
+static inline struct bgp_adj_out *
+adj_subgroup_first(struct bgp_dest *dest, struct update_subgroup *subgrp)
+{
+	struct bgp_adj_out lookup;
+	struct bgp_adj_out *adj;
+
+	lookup.subgroup = subgrp;
+	lookup.addpath_tx_id = 0;
+
+	adj = RB_NFIND(bgp_adj_out_rb, &dest->adj_out, &lookup);
+	if (adj && adj->subgroup != subgrp)
+		return NULL;
+
+	return adj;
+}
+
+static inline struct bgp_adj_out *adj_subgroup_next(struct bgp_adj_out *adj)
+{
+	struct update_subgroup *subgrp = adj->subgroup;
+
+	adj = RB_NEXT(bgp_adj_out_rb, adj);
+	if (adj && adj->subgroup != subgrp)
+		return NULL;
+
+	return adj;
+}
+
 static void adj_free(struct bgp_adj_out *adj)
 {
 	bgp_labels_unintern(&adj->labels);
 
 	TAILQ_REMOVE(&(adj->subgroup->adjq), adj, subgrp_adj_train);
 	SUBGRP_DECR_STAT(adj->subgroup, adj_count);
+	adj->subgroup->adj_version++;
 
 	RB_REMOVE(bgp_adj_out_rb, &adj->dest->adj_out, adj);
 	bgp_dest_unlock_node(adj->dest);
@@ -186,9 +219,8 @@ static void subgrp_withdraw_stale_addpath(struct updwalk_context *ctx,
 
 	/* Look through all of the paths we have advertised for this rn and send
 	 * a withdraw for the ones that are no longer present */
-	RB_FOREACH_SAFE (adj, bgp_adj_out_rb, &ctx->dest->adj_out, adj_next) {
-		if (adj->subgroup != subgrp)
-			continue;
+	for (adj = adj_subgroup_first(ctx->dest, subgrp); adj; adj = adj_next) {
+		adj_next = adj_subgroup_next(adj);
 
 		for (pi = bgp_dest_get_bgp_path_info(ctx->dest); pi;
 		     pi = pi->next) {
@@ -267,16 +299,15 @@ static int group_announce_route_walkcb(struct update_group *updgrp, void *arg)
 					/* Find the addpath_tx_id of the path we
 					 * had advertised and
 					 * send a withdraw */
-					RB_FOREACH_SAFE (adj, bgp_adj_out_rb,
-							 &ctx->dest->adj_out,
-							 adj_next) {
-						if (adj->subgroup == subgrp) {
-							subgroup_process_announce_selected(
-								subgrp, NULL,
-								ctx->dest, afi,
-								safi,
-								adj->addpath_tx_id);
-						}
+					for (adj = adj_subgroup_first(ctx->dest,
+								      subgrp);
+					     adj; adj = adj_next) {
+						adj_next = adj_subgroup_next(adj);
+
+						subgroup_process_announce_selected(
+							subgrp, NULL, ctx->dest,
+							afi, safi,
+							adj->addpath_tx_id);
 					}
 				}
 			}
@@ -481,6 +512,7 @@ struct bgp_adj_out *bgp_adj_out_alloc(struct update_subgroup *subgrp,
 
 	TAILQ_INSERT_TAIL(&(subgrp->adjq), adj, subgrp_adj_train);
 	SUBGRP_INCR_STAT(subgrp, adj_count);
+	subgrp->adj_version++;
 	return adj;
 }
 
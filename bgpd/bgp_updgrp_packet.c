@@ -638,6 +638,71 @@ bool subgroup_packets_to_build(struct update_subgroup *subgrp)
 	return false;
 }
 
+/*
+ * Bumped by bgp_generate_updgrp_packets() for every run, so that an encoded
+ * attribute set is never reused across config changes.
+ */
+uint64_t updgrp_packet_run;
+
+void subgroup_attr_cache_clear(struct update_subgroup *subgrp)
+{
+	stream_free(subgrp->attr_cache.s);
+	subgrp->attr_cache.s = NULL;
+	if (subgrp->attr_cache.attr)
+		bgp_attr_unintern(&subgrp->attr_cache.attr);
+	subgrp->attr_cache.peer = NULL;
+	subgrp->attr_cache.from = NULL;
+}
+
+/*
+ * Encode the path attributes (except MP_REACH_NLRI) for a new UPDATE of the
+ * subgroup. The advertise FIFO hands out all prefixes sharing an attribute
+ * set back to back, so when they do not fit into one packet the next packet
+ * needs the very same bytes again; copy them from the cache in that case.
+ */
+static bgp_size_t subgroup_packet_attribute(struct update_subgroup *subgrp,
+					    struct peer *peer, struct stream *s,
+					    struct attr *attr,
+					    struct bpacket_attr_vec_arr *vecarr,
+					    struct peer *from,
+					    struct bgp_path_info *path)
+{
+	size_t start = stream_get_endp(s);
+	bgp_size_t len;
+
+	if (subgrp->attr_cache.s && subgrp->attr_cache.attr == attr &&
+	    subgrp->attr_cache.peer == peer &&
+	    subgrp->attr_cache.from == from &&
+	    subgrp->attr_cache.start == start &&
+	    subgrp->attr_cache.run == updgrp_packet_run) {
+		len = stream_get_endp(subgrp->attr_cache.s);
+		stream_put(s, STREAM_DATA(subgrp->attr_cache.s), len);
+		*vecarr = subgrp->attr_cache.vecarr;
+		return len;
+	}
+
+	len = bgp_packet_attribute(NULL, peer, s, attr, vecarr, NULL,
+				   SUBGRP_AFI(subgrp), SUBGRP_SAFI(subgrp),
+				   from, NULL, NULL, 0, 0, 0, path);
+
+	subgroup_attr_cache_clear(subgrp);
+
+	/* The AIGP metric is taken from the path, not the attributes */
+	if (CHECK_FLAG(attr->flag, ATTR_FLAG_BIT(BGP_ATTR_AIGP)))
+		return len;
+
+	subgrp->attr_cache.s = stream_new(len);
+	stream_put(subgrp->attr_cache.s, STREAM_DATA(s) + start, len);
+	subgrp->attr_cache.attr = bgp_attr_intern(attr);
+	subgrp->attr_cache.peer = peer;
+	subgrp->attr_cache.from = from;
+	subgrp->attr_cache.start = start;
+	subgrp->attr_cache.run = updgrp_packet_run;
+	subgrp->attr_cache.vecarr = *vecarr;
+
+	return len;
+}
+
 /* Make BGP update packet.  */
 struct bpacket *subgroup_update_packet(struct update_subgroup *subgrp)
 {
@@ -740,9 +805,9 @@ struct bpacket *subgroup_update_packet(struct update_subgroup *subgrp)
 
 			/* 5: Encode all the attributes, except MP_REACH_NLRI
 			 * attr. */
-			total_attr_len = bgp_packet_attribute(
-				NULL, peer, s, adv->baa->attr, &vecarr, NULL,
-				afi, safi, from, NULL, NULL, 0, 0, 0, path);
+			total_attr_len = subgroup_packet_attribute(
+				subgrp, peer, s, adv->baa->attr, &vecarr, from,
+				path);
 
 			space_remaining =
 				STREAM_CONCAT_REMAIN(s, snlri, STREAM_SIZE(s))
@@ -877,6 +942,7 @@ struct bpacket *subgroup_update_packet(struct update_subgroup *subgrp)
 			subgrp->scount++;
 
 		adj->attr = bgp_attr_intern(adv->baa->attr);
+		subgrp->adj_version++;
 		adv = bgp_advertise_clean_subgroup(subgrp, adj);
 	}
 
@@ -1188,6 +1188,7 @@ void bgp_peer_connection_buffers_free(struct peer_connection *connection)
 
 void bgp_peer_connection_free(struct peer_connection **connection)
 {
+	bgp_io_connection_release(*connection);
 	bgp_peer_connection_buffers_free(*connection);
 	pthread_mutex_destroy(&(*connection)->io_mtx);
 
@@ -1210,6 +1211,7 @@ struct peer_connection *bgp_peer_connection_new(struct peer *peer)
 	connection->ibuf = stream_fifo_new();
 	connection->obuf = stream_fifo_new();
 	pthread_mutex_init(&connection->io_mtx, NULL);
+	bgp_io_connection_assign(connection);
 
 	/* We use a larger buffer for peer->obuf_work in the event that:
 	 * - We RX a BGP_UPDATE where the attributes alone are just
@@ -3940,9 +3942,6 @@ int bgp_delete(struct bgp *bgp)
 
 	hook_call(bgp_inst_delete, bgp);
 
-	FOREACH_AFI_SAFI (afi, safi)
-		EVENT_OFF(bgp->t_revalidate[afi][safi]);
-
 	EVENT_OFF(bgp->t_condition_check);
 	EVENT_OFF(bgp->t_startup);
 	EVENT_OFF(bgp->t_maxmed_onstartup);
@@ -8398,6 +8397,7 @@ void bgp_master_init(struct event_loop *master, const int buffer_size,
 	bm->v_establish_wait = BGP_UPDATE_DELAY_DEF;
 	bm->terminating = false;
 	bm->socket_buffer = buffer_size;
+	bm->io_pthreads = 1;
 	bm->wait_for_fib = false;
 	bm->ip_tos = IPTOS_PREC_INTERNETCONTROL;
 	bm->inq_limit = BM_DEFAULT_Q_LIMIT;
@@ -8489,12 +8489,15 @@ static const struct cmd_variable_handler bgp_viewvrf_var_handlers[] = {
 	{.completions = NULL},
 };
 
-struct frr_pthread *bgp_pth_io;
+struct frr_pthread *bgp_pth_io[BGP_IO_PTHREADS_MAX];
 struct frr_pthread *bgp_pth_ka;
 
 static void bgp_pthreads_init(void)
 {
-	assert(!bgp_pth_io);
+	char name[32], os_name[OS_THREAD_NAMELEN];
+	unsigned int i;
+
+	assert(!bgp_pth_io[0]);
 	assert(!bgp_pth_ka);
 
 	struct frr_pthread_attr io = {
@@ -8505,17 +8508,26 @@ static void bgp_pthreads_init(void)
 		.start = bgp_keepalives_start,
 		.stop = bgp_keepalives_stop,
 	};
-	bgp_pth_io = frr_pthread_new(&io, "BGP I/O thread", "bgpd_io");
+	bgp_pth_io[0] = frr_pthread_new(&io, "BGP I/O thread", "bgpd_io");
+	for (i = 1; i < bm->io_pthreads; i++) {
+		snprintf(name, sizeof(name), "BGP I/O thread %u", i);
+		snprintf(os_name, sizeof(os_name), "bgpd_io%u", i);
+		bgp_pth_io[i] = frr_pthread_new(&io, name, os_name);
+	}
 	bgp_pth_ka = frr_pthread_new(&ka, "BGP Keepalives thread", "bgpd_ka");
 }
 
 void bgp_pthreads_run(void)
 {
-	frr_pthread_run(bgp_pth_io, NULL);
+	unsigned int i;
+
+	for (i = 0; i < bm->io_pthreads; i++)
+		frr_pthread_run(bgp_pth_io[i], NULL);
 	frr_pthread_run(bgp_pth_ka, NULL);
 
 	/* Wait until threads are ready. */
-	frr_pthread_wait_running(bgp_pth_io);
+	for (i = 0; i < bm->io_pthreads; i++)
+		frr_pthread_wait_running(bgp_pth_io[i]);
 	frr_pthread_wait_running(bgp_pth_ka);
 }
 
@@ -95,7 +95,9 @@ enum bgp_af_index {
 #define FOREACH_SAFI(safi)                                            \
 	for (safi = SAFI_UNICAST; safi < SAFI_MAX; safi++)
 
-extern struct frr_pthread *bgp_pth_io;
+/* Connections are spread over the first bm->io_pthreads I/O pthreads */
+#define BGP_IO_PTHREADS_MAX 16
+extern struct frr_pthread *bgp_pth_io[BGP_IO_PTHREADS_MAX];
 extern struct frr_pthread *bgp_pth_ka;
 
 /* BGP master for system wide configurations and variables.  */
@@ -150,6 +152,9 @@ struct bgp_master {
 	/* How big should we set the socket buffer size */
 	uint32_t socket_buffer;
 
+	/* Number of I/O pthreads peer connections are spread over */
+	uint8_t io_pthreads;
+
 	/* Should we do wait for fib install globally? */
 	bool wait_for_fib;
 
@@ -455,7 +460,6 @@ struct bgp {
 	/* BGP update delay on startup */
 	struct event *t_update_delay;
 	struct event *t_establish_wait;
-	struct event *t_revalidate[AFI_MAX][SAFI_MAX];
 
 	uint8_t update_delay_over;
 	uint8_t main_zebra_update_hold;
@@ -1167,6 +1171,9 @@ struct peer_connection {
 
 	int fd;
 
+	/* I/O pthread handling this connection, see bgp_io_connection_assign */
+	uint8_t io_pthread;
+
 	/* Thread flags */
 	_Atomic uint32_t thread_flags;
 #define PEER_THREAD_WRITES_ON (1U << 0)
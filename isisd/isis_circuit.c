@@ -126,6 +126,10 @@ struct isis_circuit *isis_circuit_new(struct interface *ifp, const char *tag)
 		"/frr-interface:lib/interface/frr-isisd:isis/psnp-interval/level-1");
 	circuit->psnp_interval[1] = yang_get_default_uint16(
 		"/frr-interface:lib/interface/frr-isisd:isis/psnp-interval/level-2");
+	circuit->lsp_tx_burst = yang_get_default_uint16(
+		"/frr-interface:lib/interface/frr-isisd:isis/lsp-pacing/burst");
+	circuit->lsp_tx_interval = yang_get_default_uint16(
+		"/frr-interface:lib/interface/frr-isisd:isis/lsp-pacing/interval");
 	circuit->priority[0] = yang_get_default_uint8(
 		"/frr-interface:lib/interface/frr-isisd:isis/priority/level-1");
 	circuit->priority[1] = yang_get_default_uint8(
@@ -158,6 +162,8 @@ struct isis_circuit *isis_circuit_new(struct interface *ifp, const char *tag)
 		circuit->level_arg[i].level = i + 1;
 		circuit->level_arg[i].circuit = circuit;
 	}
+	circuit->lsp_tx_burst = DEFAULT_LSP_TX_BURST;
+	circuit->lsp_tx_interval = DEFAULT_LSP_TX_INTERVAL;
 #endif /* ifndef FABRICD */
 
 	circuit->is_type = circuit->is_type_config;
@@ -1315,6 +1321,18 @@ static int isis_interface_config_write(struct vty *vty)
 				}
 			}
 
+			/* ISIS - LSP transmit pacing */
+			if (circuit->lsp_tx_burst != DEFAULT_LSP_TX_BURST
+			    || circuit->lsp_tx_interval
+				       != DEFAULT_LSP_TX_INTERVAL) {
+				vty_out(vty,
+					" " PROTO_NAME
+					" lsp-pacing burst %u interval %u\n",
+					circuit->lsp_tx_burst,
+					circuit->lsp_tx_interval);
+				write++;
+			}
+
 			/* ISIS - Hello padding - Defaults to always so only
 			 * display if not always */
 			switch (circuit->pad_hellos) {
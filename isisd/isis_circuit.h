@@ -126,6 +126,8 @@ struct isis_circuit {
 	uint16_t hello_multiplier[ISIS_LEVELS]; /* hello-multiplier */
 	uint16_t csnp_interval[ISIS_LEVELS];    /* csnp-interval in seconds */
 	uint16_t psnp_interval[ISIS_LEVELS];    /* psnp-interval in seconds */
+	uint16_t lsp_tx_burst;		       /* LSPs sent per TX wakeup */
+	uint16_t lsp_tx_interval;	       /* msec between TX bursts */
 	uint8_t metric[ISIS_LEVELS];
 	uint32_t te_metric[ISIS_LEVELS];
 	struct isis_ext_subtlvs *ext; /* Extended parameters (TE + Adj SID */
@@ -2911,6 +2911,52 @@ void cli_show_ip_isis_psnp_interval(struct vty *vty,
 	}
 }
 
+/*
+ * XPath: /frr-interface:lib/interface/frr-isisd:isis/lsp-pacing
+ */
+DEFPY_YANG(isis_lsp_pacing, isis_lsp_pacing_cmd,
+      "isis lsp-pacing burst (1-1000)$burst interval (0-1000)$interval",
+      "IS-IS routing protocol\n"
+      "Set LSP transmit pacing\n"
+      "Maximum number of LSPs sent per burst\n"
+      "LSPs per burst\n"
+      "Delay between consecutive bursts\n"
+      "Delay in milliseconds\n")
+{
+	nb_cli_enqueue_change(vty, "./frr-isisd:isis/lsp-pacing/burst",
+			      NB_OP_MODIFY, burst_str);
+	nb_cli_enqueue_change(vty, "./frr-isisd:isis/lsp-pacing/interval",
+			      NB_OP_MODIFY, interval_str);
+
+	return nb_cli_apply_changes(vty, NULL);
+}
+
+DEFPY_YANG(no_isis_lsp_pacing, no_isis_lsp_pacing_cmd,
+      "no isis lsp-pacing [burst (1-1000) interval (0-1000)]",
+      NO_STR
+      "IS-IS routing protocol\n"
+      "Set LSP transmit pacing\n"
+      "Maximum number of LSPs sent per burst\n"
+      "LSPs per burst\n"
+      "Delay between consecutive bursts\n"
+      "Delay in milliseconds\n")
+{
+	nb_cli_enqueue_change(vty, "./frr-isisd:isis/lsp-pacing/burst",
+			      NB_OP_MODIFY, NULL);
+	nb_cli_enqueue_change(vty, "./frr-isisd:isis/lsp-pacing/interval",
+			      NB_OP_MODIFY, NULL);
+
+	return nb_cli_apply_changes(vty, NULL);
+}
+
+void cli_show_ip_isis_lsp_pacing(struct vty *vty, const struct lyd_node *dnode,
+				 bool show_defaults)
+{
+	vty_out(vty, " isis lsp-pacing burst %s interval %s\n",
+		yang_dnode_get_string(dnode, "burst"),
+		yang_dnode_get_string(dnode, "interval"));
+}
+
 /*
  * XPath: /frr-interface:lib/interface/frr-isisd:isis/multi-topology
  */
@@ -4075,6 +4121,8 @@ void isis_cli_init(void)
 
 	install_element(INTERFACE_NODE, &psnp_interval_cmd);
 	install_element(INTERFACE_NODE, &no_psnp_interval_cmd);
+	install_element(INTERFACE_NODE, &isis_lsp_pacing_cmd);
+	install_element(INTERFACE_NODE, &no_isis_lsp_pacing_cmd);
 
 	install_element(INTERFACE_NODE, &circuit_topology_cmd);
 
@@ -72,6 +72,12 @@
 #define MAX_PSNP_INTERVAL             120
 #define DEFAULT_PSNP_INTERVAL         2
 
+#define MIN_LSP_TX_BURST              1
+#define MAX_LSP_TX_BURST              1000
+#define DEFAULT_LSP_TX_BURST          100
+#define MAX_LSP_TX_INTERVAL           1000 /* msec */
+#define DEFAULT_LSP_TX_INTERVAL       0    /* msec */
+
 #define MIN_HELLO_INTERVAL            1
 #define MAX_HELLO_INTERVAL            600
 #define DEFAULT_HELLO_INTERVAL        3
@@ -466,8 +466,12 @@ static void lsp_update_data(struct isis_lsp *lsp, struct isis_lsp_hdr *hdr,
 			    struct isis_tlvs *tlvs, struct stream *stream,
 			    struct isis_area *area, int level)
 {
-	/* free the old lsp data */
-	lsp_clear_data(lsp);
+	/* free the old lsp data, unless the caller found the content to be
+	 * unchanged and didn't decode it again */
+	if (tlvs) {
+		lsp_clear_data(lsp);
+		lsp->tlvs = tlvs;
+	}
 
 	/* copying only the relevant part of our stream */
 	if (lsp->pdu != NULL)
@@ -480,9 +484,7 @@ static void lsp_update_data(struct isis_lsp *lsp, struct isis_lsp_hdr *hdr,
 	lsp->age_out = ZERO_AGE_LIFETIME;
 	lsp->installed = time(NULL);
 
-	lsp->tlvs = tlvs;
-
-	if (area->dynhostname && lsp->tlvs->hostname
+	if (area->dynhostname && lsp->tlvs && lsp->tlvs->hostname
 	    && lsp->hdr.rem_lifetime) {
 		isis_dynhn_insert(
 			area->isis, lsp->hdr.lsp_id, lsp->tlvs->hostname,
@@ -507,10 +509,86 @@ static void lsp_link_fragment(struct isis_lsp *lsp, struct isis_lsp *lsp0)
 	}
 }
 
+const char *lsp_change2str(enum lsp_change change)
+{
+	switch (change) {
+	case LSP_CHANGE_NONE:
+		return "none";
+	case LSP_CHANGE_TE:
+		return "TE only";
+	case LSP_CHANGE_PREFIX:
+		return "prefix only";
+	case LSP_CHANGE_TOPOLOGY:
+		return "topology";
+	case LSP_CHANGE_MAX:
+		break;
+	}
+
+	return "unknown";
+}
+
+/*
+ * TE sub-TLVs and router IDs are inputs to the route computation when
+ * Segment Routing, Flex-Algo or any form of LFA is in use.
+ */
+static bool lsp_te_used_by_spf(struct isis_area *area, int level)
+{
+	if (area->srdb.enabled || area->srv6db.config.enabled)
+		return true;
+
+	if (area->lfa_protected_links[level - 1]
+	    || area->rlfa_protected_links[level - 1]
+	    || area->tilfa_protected_links[level - 1])
+		return true;
+
+#ifndef FABRICD
+	if (listcount(area->flex_algos->flex_algos))
+		return true;
+#endif /* ifndef FABRICD */
+
+	return false;
+}
+
+/*
+ * Classify the content change between the LSP we have and the one we are
+ * about to replace it with, so that refreshes and TE updates don't trigger
+ * route computation.
+ */
+static enum lsp_change lsp_update_classify(struct isis_lsp *lsp,
+					   struct isis_lsp_hdr *hdr,
+					   struct isis_tlvs *tlvs,
+					   struct isis_area *area, int level)
+{
+	uint8_t diff;
+
+	if (!lsp->tlvs || !lsp->hdr.seqno || !lsp->hdr.rem_lifetime
+	    || !hdr->rem_lifetime || lsp->hdr.lsp_bits != hdr->lsp_bits)
+		return LSP_CHANGE_TOPOLOGY;
+
+	/* content known to be unchanged */
+	if (!tlvs)
+		return LSP_CHANGE_NONE;
+
+	diff = isis_tlvs_diff(lsp->tlvs, tlvs);
+	if (CHECK_FLAG(diff, ISIS_TLVS_DIFF_TOPOLOGY))
+		return LSP_CHANGE_TOPOLOGY;
+	if (CHECK_FLAG(diff, ISIS_TLVS_DIFF_TE)
+	    && lsp_te_used_by_spf(area, level))
+		return LSP_CHANGE_TOPOLOGY;
+	if (CHECK_FLAG(diff, ISIS_TLVS_DIFF_PREFIX))
+		return LSP_CHANGE_PREFIX;
+	if (CHECK_FLAG(diff, ISIS_TLVS_DIFF_TE))
+		return LSP_CHANGE_TE;
+
+	return LSP_CHANGE_NONE;
+}
+
 void lsp_update(struct isis_lsp *lsp, struct isis_lsp_hdr *hdr,
 		struct isis_tlvs *tlvs, struct stream *stream,
 		struct isis_area *area, int level, bool confusion)
 {
+	enum lsp_change change = LSP_CHANGE_TOPOLOGY;
+
 	if (lsp->own_lsp) {
 		flog_err(
 			EC_LIB_DEVELOPMENT,
@@ -523,6 +601,7 @@ void lsp_update(struct isis_lsp *lsp, struct isis_lsp_hdr *hdr,
 	if (confusion) {
 		lsp_purge(lsp, level, NULL);
 	} else {
+		change = lsp_update_classify(lsp, hdr, tlvs, area, level);
 		lsp_update_data(lsp, hdr, tlvs, stream, area, level);
 	}
 
@@ -538,7 +617,13 @@ void lsp_update(struct isis_lsp *lsp, struct isis_lsp_hdr *hdr,
 	}
 
 	if (lsp->hdr.seqno) {
-		isis_spf_schedule(lsp->area, lsp->level);
+		area->lsp_change_count[level - 1][change]++;
+		if (IS_DEBUG_SPF_EVENTS)
+			zlog_debug("ISIS-SPF (%s) L%d LSP %pLS seq 0x%08x change: %s",
+				   area->area_tag, level, lsp->hdr.lsp_id,
+				   lsp->hdr.seqno, lsp_change2str(change));
+		if (change >= LSP_CHANGE_PREFIX)
+			isis_spf_schedule(lsp->area, lsp->level);
 		isis_te_lsp_event(lsp, LSP_UPD);
 	}
 }
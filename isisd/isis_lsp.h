@@ -93,6 +93,15 @@ void lsp_purge_non_exist(int level, struct isis_lsp_hdr *hdr,
 #define LSP_NEWER 2
 #define LSP_OLDER 3
 
+/* Effect of a received LSP update on route computation */
+enum lsp_change {
+	LSP_CHANGE_NONE = 0, /* refresh, or no routing relevant change */
+	LSP_CHANGE_TE,	     /* TE information only, no SPF needed */
+	LSP_CHANGE_PREFIX,   /* prefixes only, topology unchanged */
+	LSP_CHANGE_TOPOLOGY, /* full SPF needed */
+	LSP_CHANGE_MAX,
+};
+
 #define LSP_PSEUDO_ID(I) ((I)[ISIS_SYS_ID_LEN])
 #define LSP_FRAGMENT(I) ((I)[ISIS_SYS_ID_LEN + 1])
 #define OWNLSPID(I)                                                            \
@@ -106,6 +115,7 @@ void lsp_update(struct isis_lsp *lsp, struct isis_lsp_hdr *hdr,
 		struct isis_tlvs *tlvs, struct stream *stream,
 		struct isis_area *area, int level, bool confusion);
 void lsp_inc_seqno(struct isis_lsp *lsp, uint32_t seqno);
+const char *lsp_change2str(enum lsp_change change);
 void lspid_print(uint8_t *lsp_id, char *dest, size_t dest_len, char dynhost,
 		 char frag, struct isis *isis);
 void lsp_print_common(struct isis_lsp *lsp, struct vty *vty,
@@ -1017,6 +1017,24 @@ const struct frr_yang_module_info frr_isisd_info = {
 				.modify = lib_interface_isis_psnp_interval_level_2_modify,
 			},
 		},
+		{
+			.xpath = "/frr-interface:lib/interface/frr-isisd:isis/lsp-pacing",
+			.cbs = {
+				.cli_show = cli_show_ip_isis_lsp_pacing,
+			},
+		},
+		{
+			.xpath = "/frr-interface:lib/interface/frr-isisd:isis/lsp-pacing/burst",
+			.cbs = {
+				.modify = lib_interface_isis_lsp_pacing_burst_modify,
+			},
+		},
+		{
+			.xpath = "/frr-interface:lib/interface/frr-isisd:isis/lsp-pacing/interval",
+			.cbs = {
+				.modify = lib_interface_isis_lsp_pacing_interval_modify,
+			},
+		},
 		{
 			.xpath = "/frr-interface:lib/interface/frr-isisd:isis/hello/padding",
 			.cbs = {
@@ -357,6 +357,9 @@ int lib_interface_isis_psnp_interval_level_1_modify(
 	struct nb_cb_modify_args *args);
 int lib_interface_isis_psnp_interval_level_2_modify(
 	struct nb_cb_modify_args *args);
+int lib_interface_isis_lsp_pacing_burst_modify(struct nb_cb_modify_args *args);
+int lib_interface_isis_lsp_pacing_interval_modify(
+	struct nb_cb_modify_args *args);
 int lib_interface_isis_hello_padding_modify(struct nb_cb_modify_args *args);
 int lib_interface_isis_hello_interval_level_1_modify(
 	struct nb_cb_modify_args *args);
@@ -685,6 +688,8 @@ void cli_show_ip_isis_csnp_interval(struct vty *vty,
 void cli_show_ip_isis_psnp_interval(struct vty *vty,
 				    const struct lyd_node *dnode,
 				    bool show_defaults);
+void cli_show_ip_isis_lsp_pacing(struct vty *vty, const struct lyd_node *dnode,
+				 bool show_defaults);
 void cli_show_ip_isis_mt_standard(struct vty *vty, const struct lyd_node *dnode,
 				  bool show_defaults);
 void cli_show_ip_isis_mt_ipv4_multicast(struct vty *vty,
@@ -3997,6 +3997,39 @@ int lib_interface_isis_psnp_interval_level_2_modify(
 	return NB_OK;
 }
 
+/*
+ * XPath: /frr-interface:lib/interface/frr-isisd:isis/lsp-pacing/burst
+ */
+int lib_interface_isis_lsp_pacing_burst_modify(struct nb_cb_modify_args *args)
+{
+	struct isis_circuit *circuit;
+
+	if (args->event != NB_EV_APPLY)
+		return NB_OK;
+
+	circuit = nb_running_get_entry(args->dnode, NULL, true);
+	circuit->lsp_tx_burst = yang_dnode_get_uint16(args->dnode, NULL);
+
+	return NB_OK;
+}
+
+/*
+ * XPath: /frr-interface:lib/interface/frr-isisd:isis/lsp-pacing/interval
+ */
+int lib_interface_isis_lsp_pacing_interval_modify(
+	struct nb_cb_modify_args *args)
+{
+	struct isis_circuit *circuit;
+
+	if (args->event != NB_EV_APPLY)
+		return NB_OK;
+
+	circuit = nb_running_get_entry(args->dnode, NULL, true);
+	circuit->lsp_tx_interval = yang_dnode_get_uint16(args->dnode, NULL);
+
+	return NB_OK;
+}
+
 /*
  * XPath: /frr-interface:lib/interface/frr-isisd:isis/hello/padding
  */
@@ -848,6 +848,34 @@ static void lsp_flood_or_update(struct isis_lsp *lsp,
  * ISO - 10589
  * Section 7.3.15.1 - Action on receipt of a link state PDU
  */
+static void process_lsp_unpack_error(struct isis_circuit *circuit,
+				     struct isis_lsp_hdr *hdr,
+				     const char *raw_pdu, size_t raw_pdu_len,
+				     const char *error_log)
+{
+	zlog_warn("Something went wrong unpacking the LSP: %s", error_log);
+#ifndef FABRICD
+	/* send northbound notification. Note that the tlv-type and
+	 * offset cannot correctly be set here as they are not returned
+	 * by isis_unpack_tlvs, but in there I cannot fire a
+	 * notification because I have no circuit information. So until
+	 * we change the code above to return those extra fields, we
+	 * will send dummy values which are ignored in the callback
+	 */
+	circuit->lsp_error_counter++;
+	if (circuit->is_type == IS_LEVEL_1) {
+		circuit->area->lsp_error_counter[0]++;
+	} else if (circuit->is_type == IS_LEVEL_2) {
+		circuit->area->lsp_error_counter[1]++;
+	} else {
+		circuit->area->lsp_error_counter[0]++;
+		circuit->area->lsp_error_counter[1]++;
+	}
+
+	isis_notif_lsp_error(circuit, hdr->lsp_id, raw_pdu, raw_pdu_len, 0, 0);
+#endif /* ifndef FABRICD */
+}
+
 static int process_lsp(uint8_t pdu_type, struct isis_circuit *circuit,
 		       const uint8_t *ssnpa, uint8_t max_area_addrs)
 {
@@ -963,34 +991,21 @@ static int process_lsp(uint8_t pdu_type, struct isis_circuit *circuit,
 	}
 
 	struct isis_tlvs *tlvs = NULL;
+	struct isis_tlv_view view;
 	int retval = ISIS_WARNING;
 	const char *error_log;
 
-	if (isis_unpack_tlvs(STREAM_READABLE(circuit->rcv_stream),
-			     circuit->rcv_stream, &tlvs, &error_log)) {
-		zlog_warn("Something went wrong unpacking the LSP: %s",
-			  error_log);
-#ifndef FABRICD
-		/* send northbound notification. Note that the tlv-type and
-		 * offset cannot correctly be set here as they are not returned
-		 * by isis_unpack_tlvs, but in there I cannot fire a
-		 * notification because I have no circuit information. So until
-		 * we change the code above to return those extra fields, we
-		 * will send dummy values which are ignored in the callback
-		 */
-		circuit->lsp_error_counter++;
-		if (circuit->is_type == IS_LEVEL_1) {
-			circuit->area->lsp_error_counter[0]++;
-		} else if (circuit->is_type == IS_LEVEL_2) {
-			circuit->area->lsp_error_counter[1]++;
-		} else {
-			circuit->area->lsp_error_counter[0]++;
-			circuit->area->lsp_error_counter[1]++;
-		}
-
-		isis_notif_lsp_error(circuit, hdr.lsp_id, raw_pdu,
-				     sizeof(raw_pdu), 0, 0);
-#endif /* ifndef FABRICD */
+	/*
+	 * Only index the TLVs for now and decode what authentication needs.
+	 * The full content is decoded once we know the LSP is going to be
+	 * stored, which saves the work for duplicates during flooding.
+	 */
+	if (isis_tlv_view_init(&view, circuit->rcv_stream,
+			       STREAM_READABLE(circuit->rcv_stream),
+			       &error_log)
+	    || isis_tlv_view_unpack(&view, ISIS_TLV_AUTH, &tlvs, &error_log)) {
+		process_lsp_unpack_error(circuit, &hdr, raw_pdu,
+					 sizeof(raw_pdu), error_log);
 		goto out;
 	}
 
@@ -1086,6 +1101,32 @@ static int process_lsp(uint8_t pdu_type, struct isis_circuit *circuit,
 	bool lsp_confusion;
 
 dontcheckadj:
+	/*
+	 * Decode the whole LSP if it may be stored. An LSP equal to ours has
+	 * the same content as the copy we already decoded, so it is kept.
+	 *
+	 * Own, older and equal LSPs are therefore acked or answered without
+	 * decoding their body, so a malformed body is no longer rejected for
+	 * them. That is safe: handling them only needs the authentication
+	 * TLVs, which were decoded above, and nothing of their content is
+	 * stored. An equal copy is covered by seqno plus the checksum
+	 * verified on receipt.
+	 */
+	if (memcmp(hdr.lsp_id, circuit->isis->sysid, ISIS_SYS_ID_LEN)
+	    && (!lsp || comp == LSP_NEWER
+		|| (comp == LSP_EQUAL && !lsp->tlvs))) {
+		isis_free_tlvs(tlvs);
+		tlvs = NULL;
+		if (isis_tlv_view_unpack_all(&view, &tlvs, &error_log)) {
+			process_lsp_unpack_error(circuit, &hdr, raw_pdu,
+						 sizeof(raw_pdu), error_log);
+			goto out;
+		}
+	} else {
+		isis_free_tlvs(tlvs);
+		tlvs = NULL;
+	}
+
 	/* 7.3.15.1 a) 7 - Passwords for level 1 - not implemented  */
 
 	/* 7.3.15.1 a) 8 - Passwords for level 2 - not implemented  */
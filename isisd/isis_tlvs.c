@@ -7687,6 +7687,241 @@ void isis_free_tlvs(struct isis_tlvs *tlvs)
 	XFREE(MTYPE_ISIS_TLV, tlvs);
 }
 
+/* Functions to classify the differences between two TLV sets */
+
+#define TLVS_DIFF_BUF_SIZE 4096
+
+static bool packed_equal(struct stream *a, struct stream *b)
+{
+	return stream_get_endp(a) == stream_get_endp(b)
+	       && !memcmp(STREAM_DATA(a), STREAM_DATA(b), stream_get_endp(a));
+}
+
+static bool items_equal(enum isis_tlv_context context, enum isis_tlv_type type,
+			struct isis_item_list *a, struct isis_item_list *b,
+			struct stream *sa, struct stream *sb)
+{
+	struct isis_item *ia, *ib;
+	size_t min_len = 0;
+
+	if (a->count != b->count)
+		return false;
+
+	for (ia = a->head, ib = b->head; ia && ib;
+	     ia = ia->next, ib = ib->next) {
+		stream_reset(sa);
+		stream_reset(sb);
+		if (pack_item(context, type, ia, sa, &min_len, NULL, NULL, 0)
+		    || pack_item(context, type, ib, sb, &min_len, NULL, NULL, 0))
+			return false;
+		if (!packed_equal(sa, sb))
+			return false;
+	}
+
+	return true;
+}
+
+static struct isis_item_list *mt_items_next_used(struct isis_item_list *l)
+{
+	while (l && !l->count)
+		l = RB_NEXT(isis_mt_item_list, l);
+
+	return l;
+}
+
+static bool mt_items_equal(enum isis_tlv_context context,
+			   enum isis_tlv_type type, struct isis_mt_item_list *a,
+			   struct isis_mt_item_list *b, struct stream *sa,
+			   struct stream *sb)
+{
+	struct isis_item_list *la, *lb;
+
+	la = mt_items_next_used(RB_MIN(isis_mt_item_list, a));
+	lb = mt_items_next_used(RB_MIN(isis_mt_item_list, b));
+	while (la && lb) {
+		if (la->mtid != lb->mtid
+		    || !items_equal(context, type, la, lb, sa, sb))
+			return false;
+
+		la = mt_items_next_used(RB_NEXT(isis_mt_item_list, la));
+		lb = mt_items_next_used(RB_NEXT(isis_mt_item_list, lb));
+	}
+
+	return la == lb;
+}
+
+/*
+ * Extended IS reachability carries both the topology (neighbor and metric)
+ * and the TE information (sub-TLVs), which are classified separately.
+ */
+static uint8_t extended_reach_diff(struct isis_item_list *a,
+				   struct isis_item_list *b, struct stream *sa,
+				   struct stream *sb)
+{
+	struct isis_extended_reach *ra, *rb;
+	uint8_t diff = 0;
+	size_t min_len = 0;
+
+	if (a->count != b->count)
+		return ISIS_TLVS_DIFF_TOPOLOGY;
+
+	for (ra = (struct isis_extended_reach *)a->head,
+	    rb = (struct isis_extended_reach *)b->head;
+	     ra && rb; ra = ra->next, rb = rb->next) {
+		if (memcmp(ra->id, rb->id, sizeof(ra->id))
+		    || ra->metric != rb->metric)
+			return ISIS_TLVS_DIFF_TOPOLOGY;
+
+		if (CHECK_FLAG(diff, ISIS_TLVS_DIFF_TE))
+			continue;
+
+		if (!ra->subtlvs || !rb->subtlvs) {
+			if (ra->subtlvs != rb->subtlvs)
+				SET_FLAG(diff, ISIS_TLVS_DIFF_TE);
+			continue;
+		}
+
+		stream_reset(sa);
+		stream_reset(sb);
+		if (pack_item_ext_subtlvs(ra->subtlvs, sa, &min_len)
+		    || pack_item_ext_subtlvs(rb->subtlvs, sb, &min_len)
+		    || !packed_equal(sa, sb))
+			SET_FLAG(diff, ISIS_TLVS_DIFF_TE);
+	}
+
+	return diff;
+}
+
+static uint8_t mt_extended_reach_diff(struct isis_mt_item_list *a,
+				      struct isis_mt_item_list *b,
+				      struct stream *sa, struct stream *sb)
+{
+	struct isis_item_list *la, *lb;
+	uint8_t diff = 0;
+
+	la = mt_items_next_used(RB_MIN(isis_mt_item_list, a));
+	lb = mt_items_next_used(RB_MIN(isis_mt_item_list, b));
+	while (la && lb) {
+		if (la->mtid != lb->mtid)
+			return ISIS_TLVS_DIFF_TOPOLOGY;
+
+		diff |= extended_reach_diff(la, lb, sa, sb);
+		if (CHECK_FLAG(diff, ISIS_TLVS_DIFF_TOPOLOGY))
+			return diff;
+
+		la = mt_items_next_used(RB_NEXT(isis_mt_item_list, la));
+		lb = mt_items_next_used(RB_NEXT(isis_mt_item_list, lb));
+	}
+
+	if (la != lb)
+		return ISIS_TLVS_DIFF_TOPOLOGY;
+
+	return diff;
+}
+
+#define TLV_PACKED_EQUAL(_pack_, _a_, _b_, _sa_, _sb_)                         \
+	(stream_reset(_sa_), stream_reset(_sb_),                               \
+	 !_pack_((_a_), (_sa_)) && !_pack_((_b_), (_sb_))                      \
+		 && packed_equal((_sa_), (_sb_)))
+
+/*
+ * Compare two versions of the same LSP and report which classes of
+ * information changed, as a mask of ISIS_TLVS_DIFF_* flags. The comparison
+ * is done on the encoded form of each TLV and is order sensitive, which
+ * errs on the side of reporting a change.
+ */
+uint8_t isis_tlvs_diff(struct isis_tlvs *old_tlvs, struct isis_tlvs *new_tlvs)
+{
+	struct stream *sa, *sb;
+	uint8_t diff = 0;
+
+	if (!old_tlvs || !new_tlvs)
+		return ISIS_TLVS_DIFF_TOPOLOGY;
+
+	sa = stream_new(TLVS_DIFF_BUF_SIZE);
+	sb = stream_new(TLVS_DIFF_BUF_SIZE);
+
+	/* Topology */
+	diff |= extended_reach_diff(&old_tlvs->extended_reach,
+				    &new_tlvs->extended_reach, sa, sb);
+	diff |= mt_extended_reach_diff(&old_tlvs->mt_reach, &new_tlvs->mt_reach,
+				       sa, sb);
+	if (!items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_OLDSTYLE_REACH,
+			 &old_tlvs->oldstyle_reach, &new_tlvs->oldstyle_reach,
+			 sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_AREA_ADDRESSES,
+			    &old_tlvs->area_addresses,
+			    &new_tlvs->area_addresses, sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_MT_ROUTER_INFO,
+			    &old_tlvs->mt_router_info,
+			    &new_tlvs->mt_router_info, sa, sb)
+	    || old_tlvs->mt_router_info_empty != new_tlvs->mt_router_info_empty
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_IPV4_ADDRESS,
+			    &old_tlvs->ipv4_address, &new_tlvs->ipv4_address,
+			    sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_IPV6_ADDRESS,
+			    &old_tlvs->ipv6_address, &new_tlvs->ipv6_address,
+			    sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_GLOBAL_IPV6_ADDRESS,
+			    &old_tlvs->global_ipv6_address,
+			    &new_tlvs->global_ipv6_address, sa, sb)
+	    || !TLV_PACKED_EQUAL(pack_tlv_protocols_supported,
+				 &old_tlvs->protocols_supported,
+				 &new_tlvs->protocols_supported, sa, sb)
+	    || !TLV_PACKED_EQUAL(pack_tlv_router_cap, old_tlvs->router_cap,
+				 new_tlvs->router_cap, sa, sb)
+	    || !TLV_PACKED_EQUAL(pack_tlv_spine_leaf, old_tlvs->spine_leaf,
+				 new_tlvs->spine_leaf, sa, sb))
+		SET_FLAG(diff, ISIS_TLVS_DIFF_TOPOLOGY);
+
+	/* Prefixes */
+	if (!items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_OLDSTYLE_IP_REACH,
+			 &old_tlvs->oldstyle_ip_reach,
+			 &new_tlvs->oldstyle_ip_reach, sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_OLDSTYLE_IP_REACH_EXT,
+			    &old_tlvs->oldstyle_ip_reach_ext,
+			    &new_tlvs->oldstyle_ip_reach_ext, sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_EXTENDED_IP_REACH,
+			    &old_tlvs->extended_ip_reach,
+			    &new_tlvs->extended_ip_reach, sa, sb)
+	    || !mt_items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_MT_IP_REACH,
+			       &old_tlvs->mt_ip_reach, &new_tlvs->mt_ip_reach,
+			       sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_IPV6_REACH,
+			    &old_tlvs->ipv6_reach, &new_tlvs->ipv6_reach, sa,
+			    sb)
+	    || !mt_items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_MT_IPV6_REACH,
+			       &old_tlvs->mt_ipv6_reach,
+			       &new_tlvs->mt_ipv6_reach, sa, sb)
+	    || !mt_items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_SRV6_LOCATOR,
+			       &old_tlvs->srv6_locator,
+			       &new_tlvs->srv6_locator, sa, sb))
+		SET_FLAG(diff, ISIS_TLVS_DIFF_PREFIX);
+
+	/* Traffic Engineering */
+	if (!TLV_PACKED_EQUAL(pack_tlv_te_router_id, old_tlvs->te_router_id,
+			      new_tlvs->te_router_id, sa, sb)
+	    || !TLV_PACKED_EQUAL(pack_tlv_te_router_id_ipv6,
+				 old_tlvs->te_router_id_ipv6,
+				 new_tlvs->te_router_id_ipv6, sa, sb))
+		SET_FLAG(diff, ISIS_TLVS_DIFF_TE);
+
+	/* Everything else */
+	if (!TLV_PACKED_EQUAL(pack_tlv_dynamic_hostname, old_tlvs->hostname,
+			      new_tlvs->hostname, sa, sb)
+	    || !items_equal(ISIS_CONTEXT_LSP, ISIS_TLV_AUTH,
+			    &old_tlvs->isis_auth, &new_tlvs->isis_auth, sa, sb)
+	    || !TLV_PACKED_EQUAL(pack_tlv_purge_originator,
+				 old_tlvs->purge_originator,
+				 new_tlvs->purge_originator, sa, sb))
+		SET_FLAG(diff, ISIS_TLVS_DIFF_OTHER);
+
+	stream_free(sa);
+	stream_free(sb);
+
+	return diff;
+}
+
 static void add_padding(struct stream *s)
 {
 	while (STREAM_WRITEABLE(s)) {
@@ -8069,6 +8304,116 @@ int isis_unpack_tlvs(size_t avail_len, struct stream *stream,
 	return rv;
 }
 
+int isis_tlv_view_init(struct isis_tlv_view *view, struct stream *stream,
+		       size_t avail_len, const char **log)
+{
+	static struct sbuf logbuf;
+	const uint8_t *data;
+	size_t pos = 0;
+	uint8_t tlv_type, tlv_len;
+	int rv = 0;
+
+	if (!sbuf_buf(&logbuf))
+		sbuf_init(&logbuf, NULL, 0);
+
+	sbuf_reset(&logbuf);
+	memset(view, 0, sizeof(*view));
+
+	if (avail_len > STREAM_READABLE(stream) || avail_len > UINT16_MAX) {
+		sbuf_push(&logbuf, 0,
+			  "Stream doesn't contain sufficient data. Claimed %zu, available %zu\n",
+			  avail_len, STREAM_READABLE(stream));
+		*log = sbuf_buf(&logbuf);
+		return 1;
+	}
+
+	view->stream = stream;
+	view->start = stream_get_getp(stream);
+	view->len = avail_len;
+	data = STREAM_DATA(stream) + view->start;
+
+	while (pos < avail_len) {
+		if (avail_len - pos < 2) {
+			sbuf_push(&logbuf, 0,
+				  "Available data %zu too short to contain a TLV header.\n",
+				  avail_len - pos);
+			rv = 1;
+			break;
+		}
+
+		tlv_type = data[pos];
+		tlv_len = data[pos + 1];
+		if (avail_len - pos - 2 < tlv_len) {
+			sbuf_push(&logbuf, 0,
+				  "Available data %zu too short for claimed TLV len %hhu.\n",
+				  avail_len - pos - 2, tlv_len);
+			rv = 1;
+			break;
+		}
+
+		if (!view->count[tlv_type])
+			view->first[tlv_type] = pos;
+		view->count[tlv_type]++;
+		view->tlv_count++;
+
+		pos += 2 + tlv_len;
+	}
+
+	/* Leave the stream as a full unpack would have */
+	if (!rv)
+		stream_forward_getp(stream, avail_len);
+
+	*log = sbuf_buf(&logbuf);
+	return rv;
+}
+
+/*
+ * Decode the TLVs of the given type from the view into *dest, which is
+ * allocated if needed. Other TLVs are skipped over using the index.
+ */
+int isis_tlv_view_unpack(const struct isis_tlv_view *view, uint8_t type,
+			 struct isis_tlvs **dest, const char **log)
+{
+	static struct sbuf logbuf;
+	const uint8_t *data = STREAM_DATA(view->stream) + view->start;
+	size_t getp = stream_get_getp(view->stream);
+	unsigned int found = 0;
+	size_t pos;
+	int rv = 0;
+
+	if (!sbuf_buf(&logbuf))
+		sbuf_init(&logbuf, NULL, 0);
+
+	sbuf_reset(&logbuf);
+
+	if (!*dest)
+		*dest = isis_alloc_tlvs();
+
+	for (pos = view->first[type]; found < view->count[type];
+	     pos += 2 + data[pos + 1]) {
+		if (data[pos] != type)
+			continue;
+
+		found++;
+		stream_set_getp(view->stream, view->start + pos);
+		rv = unpack_tlv(ISIS_CONTEXT_LSP, view->len - pos, view->stream,
+				&logbuf, *dest, 0, NULL);
+		if (rv)
+			break;
+	}
+
+	stream_set_getp(view->stream, getp);
+	*log = sbuf_buf(&logbuf);
+	return rv;
+}
+
+int isis_tlv_view_unpack_all(const struct isis_tlv_view *view,
+			     struct isis_tlvs **dest, const char **log)
+{
+	stream_set_getp(view->stream, view->start);
+	return isis_unpack_tlvs(view->len, view->stream, dest, log);
+}
+
 #define TLV_OPS(_name_, _desc_)                                                \
 	static const struct tlv_ops tlv_##_name_##_ops = {                     \
 		.name = _desc_, .unpack = unpack_tlv_##_name_,                 \
@@ -763,6 +763,41 @@ const char *isis_format_tlvs(struct isis_tlvs *tlvs, struct json_object *json);
 struct isis_tlvs *isis_copy_tlvs(struct isis_tlvs *tlvs);
 struct list *isis_fragment_tlvs(struct isis_tlvs *tlvs, size_t size);
 
+/*
+ * Lazily parsed view of the TLVs of a received PDU. Building the view only
+ * validates the TLV framing and indexes where each TLV type starts in the
+ * PDU; TLV contents are decoded on demand.
+ */
+struct isis_tlv_view {
+	struct stream *stream;
+	size_t start; /* offset of the first TLV in stream */
+	size_t len;   /* length of the TLV area */
+
+	unsigned int tlv_count;
+	uint16_t count[ISIS_TLV_MAX]; /* number of TLVs per type */
+	uint16_t first[ISIS_TLV_MAX]; /* offset of first TLV per type */
+};
+
+int isis_tlv_view_init(struct isis_tlv_view *view, struct stream *stream,
+		       size_t avail_len, const char **log);
+int isis_tlv_view_unpack(const struct isis_tlv_view *view, uint8_t type,
+			 struct isis_tlvs **dest, const char **log);
+int isis_tlv_view_unpack_all(const struct isis_tlv_view *view,
+			     struct isis_tlvs **dest, const char **log);
+
+static inline bool isis_tlv_view_has(const struct isis_tlv_view *view,
+				     uint8_t type)
+{
+	return view->count[type] != 0;
+}
+
+/* Classes of TLV changes between two versions of the same LSP */
+#define ISIS_TLVS_DIFF_TOPOLOGY 0x01 /* IS reachability, MT, capabilities */
+#define ISIS_TLVS_DIFF_PREFIX   0x02 /* IP/IPv6 reachability, SRv6 locators */
+#define ISIS_TLVS_DIFF_TE       0x04 /* TE sub-TLVs and TE router IDs */
+#define ISIS_TLVS_DIFF_OTHER    0x08 /* Hostname, auth and the like */
+uint8_t isis_tlvs_diff(struct isis_tlvs *old_tlvs, struct isis_tlvs *new_tlvs);
+
 #define ISIS_EXTENDED_IP_REACH_DOWN 0x80
 #define ISIS_EXTENDED_IP_REACH_SUBTLV 0x40
 
@@ -10,6 +10,8 @@
 
 #include "hash.h"
 #include "jhash.h"
+#include "monotime.h"
+#include "typesafe.h"
 
 #include "isisd/isisd.h"
 #include "isisd/isis_flags.h"
@@ -21,21 +23,40 @@
 DEFINE_MTYPE_STATIC(ISISD, TX_QUEUE, "ISIS TX Queue");
 DEFINE_MTYPE_STATIC(ISISD, TX_QUEUE_ENTRY, "ISIS TX Queue Entry");
 
+PREDECL_DLIST(tx_queue_list);
+
+/*
+ * Entries live either on the pending list (waiting to be sent) or on the
+ * sent list (waiting for acknowledgement). Both lists are drained by a single
+ * event per queue rather than one event per entry, so that refloods of many
+ * LSPs over many circuits do not create one timer per (LSP, circuit) pair.
+ */
 struct isis_tx_queue {
 	struct isis_circuit *circuit;
 	void (*send_event)(struct isis_circuit *circuit,
 			   struct isis_lsp *, enum isis_tx_type);
 	struct hash *hash;
+
+	struct tx_queue_list_head pending;
+	/* ordered by retransmit deadline, as entries are appended */
+	struct tx_queue_list_head sent;
+
+	struct event *send;
+	struct event *retry;
 };
 
 struct isis_tx_queue_entry {
 	struct isis_lsp *lsp;
 	enum isis_tx_type type;
 	bool is_retry;
-	struct event *retry;
+	bool is_pending;
+	struct timeval retry_at;
+	struct tx_queue_list_item item;
 	struct isis_tx_queue *queue;
 };
 
+DECLARE_DLIST(tx_queue_list, struct isis_tx_queue_entry, item);
+
 static unsigned tx_queue_hash_key(const void *p)
 {
 	const struct isis_tx_queue_entry *e = p;
@@ -72,21 +93,33 @@ struct isis_tx_queue *isis_tx_queue_new(
 	rv->send_event = send_event;
 
 	rv->hash = hash_create(tx_queue_hash_key, tx_queue_hash_cmp, NULL);
+	tx_queue_list_init(&rv->pending);
+	tx_queue_list_init(&rv->sent);
 	return rv;
 }
 
 static void tx_queue_element_free(void *element)
 {
-	struct isis_tx_queue_entry *e = element;
+	XFREE(MTYPE_TX_QUEUE_ENTRY, element);
+}
 
-	EVENT_OFF(e->retry);
+static void tx_queue_unlink_all(struct isis_tx_queue *queue)
+{
+	while (tx_queue_list_pop(&queue->pending))
+		;
+	while (tx_queue_list_pop(&queue->sent))
+		;
 
-	XFREE(MTYPE_TX_QUEUE_ENTRY, e);
+	EVENT_OFF(queue->send);
+	EVENT_OFF(queue->retry);
 }
 
 void isis_tx_queue_free(struct isis_tx_queue *queue)
 {
+	tx_queue_unlink_all(queue);
 	hash_clean_and_free(&queue->hash, tx_queue_element_free);
+	tx_queue_list_fini(&queue->pending);
+	tx_queue_list_fini(&queue->sent);
 	XFREE(MTYPE_TX_QUEUE, queue);
 }
 
@@ -100,20 +133,101 @@ static struct isis_tx_queue_entry *tx_queue_find(struct isis_tx_queue *queue,
 	return hash_lookup(queue->hash, &e);
 }
 
-static void tx_queue_send_event(struct event *thread)
+static void tx_queue_unlink(struct isis_tx_queue_entry *e)
 {
-	struct isis_tx_queue_entry *e = EVENT_ARG(thread);
-	struct isis_tx_queue *queue = e->queue;
+	if (e->is_pending)
+		tx_queue_list_del(&e->queue->pending, e);
+	else
+		tx_queue_list_del(&e->queue->sent, e);
+}
 
-	event_add_timer(master, tx_queue_send_event, e, 5, &e->retry);
+static void tx_queue_send_burst(struct event *thread);
+static void tx_queue_retry_event(struct event *thread);
 
-	if (e->is_retry)
-		queue->circuit->area->lsp_rxmt_count++;
+static void tx_queue_schedule_send(struct isis_tx_queue *queue, bool paced)
+{
+	uint16_t interval = queue->circuit->lsp_tx_interval;
+
+	if (queue->send || !tx_queue_list_count(&queue->pending))
+		return;
+
+	if (paced && interval)
+		event_add_timer_msec(master, tx_queue_send_burst, queue,
+				     interval, &queue->send);
 	else
-		e->is_retry = true;
+		event_add_event(master, tx_queue_send_burst, queue, 0,
+				&queue->send);
+}
 
-	queue->send_event(queue->circuit, e->lsp, e->type);
-	/* Don't access e here anymore, send_event might have destroyed it */
+static void tx_queue_schedule_retry(struct isis_tx_queue *queue)
+{
+	struct isis_tx_queue_entry *e = tx_queue_list_first(&queue->sent);
+	struct timeval remain;
+
+	/*
+	 * An armed timer never fires later than the head of the sent list,
+	 * since deadlines only grow towards the tail. If the head has been
+	 * acknowledged meanwhile, the timer fires early and simply re-arms.
+	 */
+	if (queue->retry || !e)
+		return;
+
+	monotime_until(&e->retry_at, &remain);
+	if (remain.tv_sec < 0)
+		remain.tv_sec = remain.tv_usec = 0;
+	event_add_timer_tv(master, tx_queue_retry_event, queue, &remain,
+			   &queue->retry);
+}
+
+static void tx_queue_send_burst(struct event *thread)
+{
+	struct isis_tx_queue *queue = EVENT_ARG(thread);
+	struct isis_tx_queue_entry *e;
+	unsigned int sent = 0;
+
+	while (sent < queue->circuit->lsp_tx_burst
+	       && (e = tx_queue_list_pop(&queue->pending))) {
+		/*
+		 * Move to the sent list before transmitting, since send_event
+		 * might remove the entry from the queue again.
+		 */
+		e->is_pending = false;
+		monotime(&e->retry_at);
+		e->retry_at.tv_sec += MIN_LSP_RETRANS_INTERVAL;
+		tx_queue_list_add_tail(&queue->sent, e);
+
+		if (e->is_retry)
+			queue->circuit->area->lsp_rxmt_count++;
+		else
+			e->is_retry = true;
+
+		sent++;
+		queue->send_event(queue->circuit, e->lsp, e->type);
+		/* Don't access e here anymore, send_event might have destroyed it */
+	}
+
+	tx_queue_schedule_send(queue, true);
+	tx_queue_schedule_retry(queue);
+}
+
+static void tx_queue_retry_event(struct event *thread)
+{
+	struct isis_tx_queue *queue = EVENT_ARG(thread);
+	struct isis_tx_queue_entry *e;
+	struct timeval now;
+
+	monotime(&now);
+	while ((e = tx_queue_list_first(&queue->sent))) {
+		if (timercmp(&e->retry_at, &now, >))
+			break;
+
+		tx_queue_list_del(&queue->sent, e);
+		e->is_pending = true;
+		tx_queue_list_add_tail(&queue->pending, e);
+	}
+
+	tx_queue_schedule_send(queue, false);
+	tx_queue_schedule_retry(queue);
 }
 
 void _isis_tx_queue_add(struct isis_tx_queue *queue,
@@ -143,14 +257,20 @@ void _isis_tx_queue_add(struct isis_tx_queue *queue,
 		struct isis_tx_queue_entry *inserted;
 		inserted = hash_get(queue->hash, e, hash_alloc_intern);
 		assert(inserted == e);
+	} else if (!e->is_pending) {
+		tx_queue_list_del(&queue->sent, e);
 	}
 
-	e->type = type;
-
-	EVENT_OFF(e->retry);
-	event_add_event(master, tx_queue_send_event, e, 0, &e->retry);
+	/* An entry already waiting to be sent keeps its place in line */
+	if (!e->is_pending) {
+		e->is_pending = true;
+		tx_queue_list_add_tail(&queue->pending, e);
+	}
 
+	e->type = type;
 	e->is_retry = false;
+
+	tx_queue_schedule_send(queue, false);
 }
 
 void _isis_tx_queue_del(struct isis_tx_queue *queue, struct isis_lsp *lsp,
@@ -169,7 +289,7 @@ void _isis_tx_queue_del(struct isis_tx_queue *queue, struct isis_lsp *lsp,
 			   func, file, line);
 	}
 
-	EVENT_OFF(e->retry);
+	tx_queue_unlink(e);
 
 	hash_release(queue->hash, e);
 	XFREE(MTYPE_TX_QUEUE_ENTRY, e);
@@ -185,5 +305,6 @@ unsigned long isis_tx_queue_len(struct isis_tx_queue *queue)
 
 void isis_tx_queue_clean(struct isis_tx_queue *queue)
 {
+	tx_queue_unlink_all(queue);
 	hash_clean(queue->hash, tx_queue_element_free);
 }
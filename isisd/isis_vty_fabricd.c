@@ -1019,6 +1019,47 @@ DEFUN (no_psnp_interval,
 	return CMD_SUCCESS;
 }
 
+DEFUN (lsp_pacing,
+       lsp_pacing_cmd,
+       PROTO_NAME " lsp-pacing burst (1-1000) interval (0-1000)",
+       PROTO_HELP
+       "Set LSP transmit pacing\n"
+       "Maximum number of LSPs sent per burst\n"
+       "LSPs per burst\n"
+       "Delay between consecutive bursts\n"
+       "Delay in milliseconds\n")
+{
+	struct isis_circuit *circuit = isis_circuit_lookup(vty);
+	if (!circuit)
+		return CMD_ERR_NO_MATCH;
+
+	circuit->lsp_tx_burst = atoi(argv[3]->arg);
+	circuit->lsp_tx_interval = atoi(argv[5]->arg);
+
+	return CMD_SUCCESS;
+}
+
+DEFUN (no_lsp_pacing,
+       no_lsp_pacing_cmd,
+       "no " PROTO_NAME " lsp-pacing [burst (1-1000) interval (0-1000)]",
+       NO_STR
+       PROTO_HELP
+       "Set LSP transmit pacing\n"
+       "Maximum number of LSPs sent per burst\n"
+       "LSPs per burst\n"
+       "Delay between consecutive bursts\n"
+       "Delay in milliseconds\n")
+{
+	struct isis_circuit *circuit = isis_circuit_lookup(vty);
+	if (!circuit)
+		return CMD_ERR_NO_MATCH;
+
+	circuit->lsp_tx_burst = DEFAULT_LSP_TX_BURST;
+	circuit->lsp_tx_interval = DEFAULT_LSP_TX_INTERVAL;
+
+	return CMD_SUCCESS;
+}
+
 DEFUN (circuit_topology,
        circuit_topology_cmd,
        PROTO_NAME " topology " ISIS_MT_NAMES,
@@ -1136,6 +1177,9 @@ void isis_vty_daemon_init(void)
 	install_element(INTERFACE_NODE, &psnp_interval_cmd);
 	install_element(INTERFACE_NODE, &no_psnp_interval_cmd);
 
+	install_element(INTERFACE_NODE, &lsp_pacing_cmd);
+	install_element(INTERFACE_NODE, &no_lsp_pacing_cmd);
+
 	install_element(INTERFACE_NODE, &circuit_topology_cmd);
 	install_element(INTERFACE_NODE, &no_circuit_topology_cmd);
 }
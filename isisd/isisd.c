@@ -2222,6 +2222,18 @@ DEFUN (show_hostname,
 	return CMD_SUCCESS;
 }
 
+static void isis_lsp_change_print(struct vty *vty, struct isis_area *area,
+				  int level)
+{
+	enum lsp_change change;
+
+	vty_out(vty, "    Received LSP changes:\n");
+	for (change = LSP_CHANGE_NONE; change < LSP_CHANGE_MAX; change++)
+		vty_out(vty, "      %-11s : %" PRIu64 "\n",
+			lsp_change2str(change),
+			area->lsp_change_count[level - 1][change]);
+}
+
 static void isis_spf_ietf_common(struct vty *vty, struct isis *isis)
 {
 	struct listnode *node;
@@ -2257,6 +2269,8 @@ static void isis_spf_ietf_common(struct vty *vty, struct isis *isis)
 			} else {
 				vty_out(vty, "    Using legacy backoff algo\n");
 			}
+
+			isis_lsp_change_print(vty, area, level);
 		}
 	}
 }
@@ -2407,6 +2421,21 @@ static void common_isis_summary_json(struct json_object *json,
 					    area->lsp_gen_count[level - 1]);
 			json_object_int_add(level_json, "lsp-purged",
 					    area->lsp_purge_count[level - 1]);
+			json_object_int_add(
+				level_json, "lsp-change-none",
+				area->lsp_change_count[level - 1]
+						      [LSP_CHANGE_NONE]);
+			json_object_int_add(
+				level_json, "lsp-change-te-only",
+				area->lsp_change_count[level - 1][LSP_CHANGE_TE]);
+			json_object_int_add(
+				level_json, "lsp-change-prefix-only",
+				area->lsp_change_count[level - 1]
+						      [LSP_CHANGE_PREFIX]);
+			json_object_int_add(
+				level_json, "lsp-change-topology",
+				area->lsp_change_count[level - 1]
+						      [LSP_CHANGE_TOPOLOGY]);
 			if (area->spf_timer[level - 1])
 				json_object_string_add(level_json, "spf",
 						       "pending");
@@ -2497,6 +2526,8 @@ static void common_isis_summary_vty(struct vty *vty, struct isis *isis)
 			vty_out(vty, "         LSPs purged: %" PRIu64 "\n",
 				area->lsp_purge_count[level - 1]);
 
+			isis_lsp_change_print(vty, area, level);
+
 			if (area->spf_timer[level - 1])
 				vty_out(vty, "    SPF: (pending)\n");
 			else
@@ -198,6 +198,8 @@ struct isis_area {
 	uint32_t lsp_exceeded_max_counter;
 	uint32_t lsp_seqno_skipped_counter;
 	uint64_t spf_run_count[ISIS_LEVELS];
+	/* received LSP updates, classified by their effect on SPF */
+	uint64_t lsp_change_count[ISIS_LEVELS][LSP_CHANGE_MAX];
 	int ip_circuits;
 	/* logging adjacency changes? */
 	uint8_t log_adj_changes;
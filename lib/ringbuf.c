@@ -97,6 +97,33 @@ size_t ringbuf_peek(struct ringbuf *buf, size_t offset, void *data, size_t size)
 	return copysize;
 }
 
+int ringbuf_space_iov(struct ringbuf *buf, struct iovec iov[2])
+{
+	size_t space = ringbuf_space(buf);
+	size_t tail = MIN(space, buf->size - buf->end);
+
+	if (!space)
+		return 0;
+
+	iov[0].iov_base = buf->data + buf->end;
+	iov[0].iov_len = tail;
+	if (tail == space)
+		return 1;
+
+	iov[1].iov_base = buf->data;
+	iov[1].iov_len = space - tail;
+	return 2;
+}
+
+size_t ringbuf_commit(struct ringbuf *buf, size_t size)
+{
+	size_t commitsize = MIN(size, ringbuf_space(buf));
+
+	buf->end = (buf->end + commitsize) % buf->size;
+	buf->empty = buf->empty && !commitsize;
+	return commitsize;
+}
+
 size_t ringbuf_copy(struct ringbuf *to, struct ringbuf *from, size_t size)
 {
 	size_t tocopy = MIN(ringbuf_space(to), size);
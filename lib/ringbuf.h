@@ -9,6 +9,7 @@
 
 #include <zebra.h>
 #include <stdint.h>
+#include <sys/uio.h>
 
 #include "memory.h"
 
@@ -89,6 +90,28 @@ size_t ringbuf_get(struct ringbuf *buf, void *data, size_t size);
 size_t ringbuf_peek(struct ringbuf *buf, size_t offset, void *data,
 		    size_t size);
 
+/*
+ * Describe the free space of the ring buffer, so data can be written into
+ * it directly (e.g. with readv()) instead of going through a temporary
+ * buffer and ringbuf_put(). Once written, the data must be accounted for
+ * with ringbuf_commit().
+ *
+ * @param iov	array of two iovecs to fill in
+ * @return	number of iovecs filled in; 0 if the buffer is full, 2 if the
+ *		free space wraps around the end of the buffer
+ */
+int ringbuf_space_iov(struct ringbuf *buf, struct iovec iov[2]);
+
+/*
+ * Account for data written directly into the space described by
+ * ringbuf_space_iov().
+ *
+ * @param size	how much data was written
+ * @return	number of bytes added to the buffer; will be less than size if
+ *		size exceeds the available space
+ */
+size_t ringbuf_commit(struct ringbuf *buf, size_t size);
+
 /*
  * Copy data from one ringbuf to another.
  *
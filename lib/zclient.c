@@ -4517,17 +4517,18 @@ static zclient_handler *const lib_handlers[] = {
 };
 
 /* Zebra client message read function. */
-static void zclient_read(struct event *thread)
+/*
+ * Read and dispatch one message from zebra.
+ *
+ * Returns 1 if a message was processed, 0 if the message is not complete
+ * yet and -1 if the connection failed or was closed while processing.
+ */
+static int zclient_read_msg(struct zclient *zclient)
 {
 	size_t already;
 	uint16_t length, command;
 	uint8_t marker, version;
 	vrf_id_t vrf_id;
-	struct zclient *zclient;
-
-	/* Get socket to zebra. */
-	zclient = EVENT_ARG(thread);
-	zclient->t_read = NULL;
 
 	/* Read zebra header (if we don't have it already). */
 	already = stream_get_endp(zclient->ibuf);
@@ -4542,12 +4543,10 @@ static void zclient_read(struct event *thread)
 					"zclient connection closed socket [%d].",
 					zclient->sock);
 			zclient_failed(zclient);
-			return;
-		}
-		if (nbyte != (ssize_t)(ZEBRA_HEADER_SIZE - already)) {
-			zclient_event(ZCLIENT_READ, zclient);
-			return;
+			return -1;
 		}
+		if (nbyte != (ssize_t)(ZEBRA_HEADER_SIZE - already))
+			return 0;
 		already = ZEBRA_HEADER_SIZE;
 	}
 
@@ -4567,7 +4566,7 @@ static void zclient_read(struct event *thread)
 			"%s: socket %d version mismatch, marker %d, version %d",
 			__func__, zclient->sock, marker, version);
 		zclient_failed(zclient);
-		return;
+		return -1;
 	}
 
 	if (length < ZEBRA_HEADER_SIZE) {
@@ -4575,7 +4574,7 @@ static void zclient_read(struct event *thread)
 			 "%s: socket %d message length %u is less than %d ",
 			 __func__, zclient->sock, length, ZEBRA_HEADER_SIZE);
 		zclient_failed(zclient);
-		return;
+		return -1;
 	}
 
 	/* Length check. */
@@ -4604,13 +4603,11 @@ static void zclient_read(struct event *thread)
 					"zclient connection closed socket [%d].",
 					zclient->sock);
 			zclient_failed(zclient);
-			return;
+			return -1;
 		}
-		if (nbyte != (ssize_t)(length - already)) {
+		if (nbyte != (ssize_t)(length - already))
 			/* Try again later. */
-			zclient_event(ZCLIENT_READ, zclient);
-			return;
-		}
+			return 0;
 	}
 
 	length -= ZEBRA_HEADER_SIZE;
@@ -4627,10 +4624,35 @@ static void zclient_read(struct event *thread)
 
 	if (zclient->sock < 0)
 		/* Connection was closed during packet processing. */
-		return;
+		return -1;
 
-	/* Register read thread. */
 	stream_reset(zclient->ibuf);
+	return 1;
+}
+
+/*
+ * Zebra tends to send messages in bursts, e.g. a single IGP change can
+ * produce nexthop updates for every tracked nexthop.  Drain up to
+ * ZCLIENT_READ_BATCH messages per wakeup rather than going back through
+ * the event loop for each one.
+ */
+static void zclient_read(struct event *thread)
+{
+	struct zclient *zclient = EVENT_ARG(thread);
+	int ret;
+	int i;
+
+	zclient->t_read = NULL;
+
+	for (i = 0; i < ZCLIENT_READ_BATCH; i++) {
+		ret = zclient_read_msg(zclient);
+		if (ret < 0)
+			return;
+		if (ret == 0)
+			break;
+	}
+
+	/* Register read thread. */
 	zclient_event(ZCLIENT_READ, zclient);
 }
 
@@ -47,6 +47,9 @@ typedef uint16_t zebra_size_t;
 #define ZEBRA_MAX_PACKET_SIZ          16384U
 #define ZEBRA_SMALL_PACKET_SIZE       200U
 
+/* Max number of messages processed per read event. */
+#define ZCLIENT_READ_BATCH            100
+
 /* Zebra header size. */
 #define ZEBRA_HEADER_SIZE             10
 
@@ -115,6 +115,40 @@ static void ospf6_interface_lsdb_hook_remove(struct ospf6_lsa *lsa)
 	ospf6_interface_lsdb_hook(lsa, ospf6_lsremove_to_spf_reason(lsa));
 }
 
+static void ospf6_interface_lsdb_hook_replace(struct ospf6_lsa *old,
+					      struct ospf6_lsa *lsa)
+{
+	struct ospf6_interface *oi = lsa->lsdb->data;
+	struct ospf6_link_lsa *old_link, *new_link;
+
+	if (ntohs(lsa->header->type) != OSPF6_LSTYPE_LINK)
+		goto full;
+
+	/*
+	 * The SPF only takes the link-local address from Link-LSAs to
+	 * compute nexthops. Prefixes advertised in a Link-LSA reach the
+	 * routing table through the DR's Intra-Area-Prefix-LSA, so a
+	 * prefix-only change just needs that LSA to be reoriginated.
+	 */
+	old_link = (struct ospf6_link_lsa *)ospf6_lsa_header_end(old->header);
+	new_link = (struct ospf6_link_lsa *)ospf6_lsa_header_end(lsa->header);
+	if (!IPV6_ADDR_SAME(&old_link->linklocal_addr,
+			    &new_link->linklocal_addr)
+	    || memcmp(old_link->options, new_link->options,
+		      sizeof(old_link->options)))
+		goto full;
+
+	if (oi->state == OSPF6_INTERFACE_DR)
+		OSPF6_INTRA_PREFIX_LSA_SCHEDULE_TRANSIT(oi);
+	if (oi->area)
+		oi->area->ospf6->spf_prefix_only_skipped++;
+	return;
+
+full:
+	ospf6_interface_lsdb_hook_remove(old);
+	ospf6_interface_lsdb_hook_add(lsa);
+}
+
 static uint8_t ospf6_default_iftype(struct interface *ifp)
 {
 	if (if_is_pointopoint(ifp))
@@ -239,6 +273,7 @@ struct ospf6_interface *ospf6_interface_create(struct interface *ifp)
 	oi->lsdb = ospf6_lsdb_create(oi);
 	oi->lsdb->hook_add = ospf6_interface_lsdb_hook_add;
 	oi->lsdb->hook_remove = ospf6_interface_lsdb_hook_remove;
+	oi->lsdb->hook_replace = ospf6_interface_lsdb_hook_replace;
 	oi->lsdb_self = ospf6_lsdb_create(oi);
 
 	oi->route_connected = OSPF6_ROUTE_TABLE_CREATE(INTERFACE,
@@ -17,6 +17,9 @@ struct ospf6_lsdb {
 	uint32_t stats[OSPF6_LSTYPE_SIZE];
 	void (*hook_add)(struct ospf6_lsa *);
 	void (*hook_remove)(struct ospf6_lsa *);
+	/* if set, called instead of hook_remove + hook_add when a changed
+	 * instance replaces a live (non-MaxAge) one */
+	void (*hook_replace)(struct ospf6_lsa *old, struct ospf6_lsa *new);
 };
 
 /* Function Prototypes */
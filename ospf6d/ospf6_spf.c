@@ -437,6 +437,9 @@ static const char *const ospf6_spf_reason_str[] = {
 	"GR", /* OSPF6_SPF_FLAGS_GR_FINISH */
 };
 
+static_assert(array_size(ospf6_spf_reason_str) == OSPF6_SPF_REASON_MAX,
+	      "SPF reason strings out of sync with OSPF6_SPF_FLAGS_*");
+
 void ospf6_spf_reason_string(uint32_t reason, char *buf, int size)
 {
 	uint32_t bit;
@@ -458,6 +461,70 @@ void ospf6_spf_reason_string(uint32_t reason, char *buf, int size)
 	}
 }
 
+static void ospf6_spf_reason_stats_update(struct ospf6 *ospf6,
+					  const struct timeval *runtime)
+{
+	struct ospf6_spf_reason_stats *stats;
+	uint64_t usec = runtime->tv_sec * 1000000ULL + runtime->tv_usec;
+	uint32_t bit;
+
+	for (bit = 0; bit < OSPF6_SPF_REASON_MAX; bit++) {
+		if (!(ospf6->spf_reason & (1 << bit)))
+			continue;
+
+		stats = &ospf6->spf_reason_stats[bit];
+		stats->runs++;
+		stats->total_usec += usec;
+		if (usec > stats->max_usec)
+			stats->max_usec = usec;
+	}
+}
+
+void ospf6_spf_reason_stats_show(struct vty *vty, struct ospf6 *ospf6,
+				 json_object *json)
+{
+	const struct ospf6_spf_reason_stats *stats;
+	json_object *json_reasons = NULL;
+	json_object *json_reason;
+	uint32_t bit;
+
+	if (json) {
+		json_reasons = json_object_new_object();
+		json_object_object_add(json, "spfReasonStats", json_reasons);
+		json_object_int_add(json, "spfPrefixOnlySkipped",
+				    ospf6->spf_prefix_only_skipped);
+	} else {
+		vty_out(vty, " SPF runtime by reason:\n");
+		vty_out(vty, "   %-6s %10s %14s %12s\n", "Reason", "Runs",
+			"Total (usec)", "Max (usec)");
+	}
+
+	for (bit = 0; bit < OSPF6_SPF_REASON_MAX; bit++) {
+		stats = &ospf6->spf_reason_stats[bit];
+		if (!stats->runs)
+			continue;
+
+		if (json) {
+			json_reason = json_object_new_object();
+			json_object_int_add(json_reason, "runs", stats->runs);
+			json_object_int_add(json_reason, "totalUsec",
+					    stats->total_usec);
+			json_object_int_add(json_reason, "maxUsec",
+					    stats->max_usec);
+			json_object_object_add(json_reasons,
+					       ospf6_spf_reason_str[bit],
+					       json_reason);
+		} else
+			vty_out(vty, "   %-6s %10u %14" PRIu64 " %12" PRIu64 "\n",
+				ospf6_spf_reason_str[bit], stats->runs,
+				stats->total_usec, stats->max_usec);
+	}
+
+	if (!json)
+		vty_out(vty, " Link-LSA changes handled without SPF: %u\n",
+			ospf6->spf_prefix_only_skipped);
+}
+
 /* RFC2328 16.1.  Calculating the shortest-path tree for an area */
 /* RFC2740 3.8.1.  Calculating the shortest path tree for an area */
 void ospf6_spf_calculation(uint32_t router_id,
@@ -653,6 +720,7 @@ static void ospf6_spf_calculation_thread(struct event *t)
 	timersub(&end, &start, &runtime);
 
 	ospf6->ts_spf_duration = runtime;
+	ospf6_spf_reason_stats_update(ospf6, &runtime);
 
 	ospf6_spf_reason_string(ospf6->spf_reason, rbuf, sizeof(rbuf));
 
@@ -80,6 +80,17 @@ struct ospf6_vertex {
 #define OSPF6_SPF_FLAGS_ASBR_STATUS_CHANGE       (1 << 9)
 #define OSPF6_SPF_FLAGS_GR_FINISH                (1 << 10)
 
+/* Keep this at the highest flag above, all reason bits are counted */
+#define OSPF6_SPF_FLAGS_LAST OSPF6_SPF_FLAGS_GR_FINISH
+#define OSPF6_SPF_REASON_MAX (__builtin_ctz(OSPF6_SPF_FLAGS_LAST) + 1)
+
+/* SPF runtime accounted to a reason bit */
+struct ospf6_spf_reason_stats {
+	uint32_t runs;
+	uint64_t total_usec;
+	uint64_t max_usec;
+};
+
 static inline void ospf6_set_spf_reason(struct ospf6 *ospf, unsigned int reason)
 {
 	ospf->spf_reason |= reason;
@@ -135,6 +146,8 @@ extern void ospf6_spf_calculation(uint32_t router_id,
 				  struct ospf6_route_table *result_table,
 				  struct ospf6_area *oa);
 extern void ospf6_spf_schedule(struct ospf6 *ospf, unsigned int reason);
+extern void ospf6_spf_reason_stats_show(struct vty *vty, struct ospf6 *ospf6,
+					json_object *json);
 
 extern void ospf6_spf_display_subtree(struct vty *vty, const char *prefix,
 				      int rest, struct ospf6_vertex *v,
@@ -377,6 +377,9 @@ static struct ospf6 *ospf6_create(const char *name)
 	o->spf_holdtime = OSPF_SPF_HOLDTIME_DEFAULT;
 	o->spf_max_holdtime = OSPF_SPF_MAX_HOLDTIME_DEFAULT;
 	o->spf_hold_multiplier = 1;
+	o->spf_reason_stats = XCALLOC(MTYPE_OSPF6_TOP,
+				      sizeof(*o->spf_reason_stats) *
+					      OSPF6_SPF_REASON_MAX);
 
 	o->default_originate = DEFAULT_ORIGINATE_NONE;
 	o->redistribute = 0;
@@ -530,6 +533,7 @@ void ospf6_delete(struct ospf6 *o)
 		list_delete(&o->redist[i]);
 	}
 
+	XFREE(MTYPE_OSPF6_TOP, o->spf_reason_stats);
 	XFREE(MTYPE_OSPF6_TOP, o->name);
 	XFREE(MTYPE_OSPF6_TOP, o);
 }
@@ -1238,6 +1242,8 @@ static void ospf6_show(struct vty *vty, struct ospf6 *o, json_object *json,
 		} else
 			json_object_boolean_false_add(json, "spfTimerActive");
 
+		ospf6_spf_reason_stats_show(vty, o, json);
+
 		json_object_boolean_add(json, "routerIsStubRouter",
 					CHECK_FLAG(o->flag, OSPF6_STUB_ROUTER));
 
@@ -1322,6 +1328,8 @@ static void ospf6_show(struct vty *vty, struct ospf6 *o, json_object *json,
 			(event_is_scheduled(o->t_spf_calc) ? "due in " : "is "),
 			buf);
 
+		ospf6_spf_reason_stats_show(vty, o, NULL);
+
 		if (CHECK_FLAG(o->flag, OSPF6_STUB_ROUTER))
 			vty_out(vty, " Router Is Stub Router\n");
 
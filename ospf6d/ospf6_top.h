@@ -93,6 +93,8 @@ struct ospf6_gr_helper {
 	uint32_t last_exit_reason;
 };
 
+struct ospf6_spf_reason_stats;
+
 /* OSPFv3 top level data structure */
 struct ospf6 {
 	/* The relevant vrf_id */
@@ -167,6 +169,10 @@ struct ospf6 {
 	struct timeval ts_spf;		/* SPF calculation time stamp. */
 	struct timeval ts_spf_duration; /* Execution time of last SPF */
 	unsigned int last_spf_reason;   /* Last SPF reason */
+	/* SPF runtime accounted to each reason bit, OSPF6_SPF_REASON_MAX */
+	struct ospf6_spf_reason_stats *spf_reason_stats;
+	/* Link-LSA changes that did not need an SPF run */
+	uint32_t spf_prefix_only_skipped;
 
 	int fd;
 	/* Threads */
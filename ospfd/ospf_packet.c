@@ -3657,26 +3657,6 @@ void ospf_ls_req_send(struct ospf_neighbor *nbr)
 	OSPF_NSM_TIMER_ON(nbr->t_ls_req, ospf_ls_req_timer, nbr->v_ls_req);
 }
 
-/* Send Link State Update with an LSA. */
-void ospf_ls_upd_send_lsa(struct ospf_neighbor *nbr, struct ospf_lsa *lsa,
-			  int flag)
-{
-	struct list *update;
-
-	update = list_new();
-
-	listnode_add(update, lsa);
-
-	/*ospf instance is going down, send self originated
-	 * MAXAGE LSA update to neighbors to remove from LSDB */
-	if (nbr->oi->ospf->inst_shutdown && IS_LSA_MAXAGE(lsa))
-		ospf_ls_upd_send(nbr, update, flag, 1);
-	else
-		ospf_ls_upd_send(nbr, update, flag, 0);
-
-	list_delete(&update);
-}
-
 /* Determine size for packet. Must be at least big enough to accommodate next
  * LSA on list, which may be bigger than MTU size.
  *
@@ -3766,6 +3746,8 @@ void ospf_ls_upd_queue_send(struct ospf_interface *oi, struct list *update,
 		return;
 
 	op = ospf_ls_upd_packet_new(update, oi);
+	if (!op)
+		return;
 
 	/* Prepare OSPF common header. */
 	ospf_make_header(OSPF_MSG_LS_UPD, oi, op->s);
@@ -3829,6 +3811,7 @@ static void ospf_ls_upd_send_queue_event(struct event *thread)
 	struct route_node *rnext;
 	struct list *update;
 	char again = 0;
+	int count;
 
 	oi->t_ls_upd_event = NULL;
 
@@ -3843,7 +3826,16 @@ static void ospf_ls_upd_send_queue_event(struct event *thread)
 
 		update = (struct list *)rn->info;
 
-		ospf_ls_upd_queue_send(oi, update, rn->p.u.prefix4, 0);
+		/*
+		 * Pack everything queued for this destination into MTU-sized
+		 * LS Updates in one pass, up to as many packets as the write
+		 * thread sends per invocation.
+		 */
+		count = 0;
+		do {
+			ospf_ls_upd_queue_send(oi, update, rn->p.u.prefix4, 0);
+		} while (listcount(update) > 0
+			 && ++count < oi->ospf->write_oi_count);
 
 		/* list might not be empty. */
 		if (listcount(update) == 0) {
@@ -3867,43 +3859,48 @@ static void ospf_ls_upd_send_queue_event(struct event *thread)
 		zlog_debug("%s stop", __func__);
 }
 
-void ospf_ls_upd_send(struct ospf_neighbor *nbr, struct list *update, int flag,
-		      int send_lsupd_now)
+/* Decide destination address of an LS Update sent to a neighbor. */
+static struct in_addr ospf_ls_upd_dst(struct ospf_neighbor *nbr, int flag)
 {
-	struct ospf_interface *oi;
-	struct ospf_lsa *lsa;
-	struct prefix_ipv4 p;
-	struct route_node *rn;
-	struct listnode *node;
-
-	oi = nbr->oi;
-
-	p.family = AF_INET;
-	p.prefixlen = IPV4_MAX_BITLEN;
+	struct ospf_interface *oi = nbr->oi;
+	struct in_addr dst;
 
-	/* Decide destination address. */
 	if (oi->type == OSPF_IFTYPE_VIRTUALLINK)
-		p.prefix = oi->vl_data->peer_addr;
+		dst = oi->vl_data->peer_addr;
 	else if (oi->type == OSPF_IFTYPE_POINTOPOINT)
-		p.prefix.s_addr = htonl(OSPF_ALLSPFROUTERS);
+		dst.s_addr = htonl(OSPF_ALLSPFROUTERS);
 	else if (flag == OSPF_SEND_PACKET_DIRECT)
-		p.prefix = nbr->address.u.prefix4;
+		dst = nbr->address.u.prefix4;
 	else if (oi->state == ISM_DR || oi->state == ISM_Backup)
-		p.prefix.s_addr = htonl(OSPF_ALLSPFROUTERS);
+		dst.s_addr = htonl(OSPF_ALLSPFROUTERS);
 	else if (oi->type == OSPF_IFTYPE_POINTOMULTIPOINT)
-		p.prefix.s_addr = htonl(OSPF_ALLSPFROUTERS);
+		dst.s_addr = htonl(OSPF_ALLSPFROUTERS);
 	else
-		p.prefix.s_addr = htonl(OSPF_ALLDROUTERS);
+		dst.s_addr = htonl(OSPF_ALLDROUTERS);
 
 	if (OSPF_IF_NON_BROADCAST(oi)) {
 		if (flag == OSPF_SEND_PACKET_INDIRECT)
 			flog_warn(EC_OSPF_PACKET,
 				  "* LS-Update is directly sent on non-broadcast network.");
-		if (IPV4_ADDR_SAME(&oi->address->u.prefix4, &p.prefix))
+		if (IPV4_ADDR_SAME(&oi->address->u.prefix4, &dst))
 			flog_warn(EC_OSPF_PACKET,
 				  "* LS-Update is sent to myself.");
 	}
 
+	return dst;
+}
+
+/* Get the LS Update queue of an interface for a destination. */
+static struct list *ospf_ls_upd_queue_get(struct ospf_interface *oi,
+					  struct in_addr dst)
+{
+	struct prefix_ipv4 p;
+	struct route_node *rn;
+
+	p.family = AF_INET;
+	p.prefixlen = IPV4_MAX_BITLEN;
+	p.prefix = dst;
+
 	rn = route_node_get(oi->ls_upd_queue, (struct prefix *)&p);
 
 	if (rn->info == NULL)
@@ -3911,9 +3908,24 @@ void ospf_ls_upd_send(struct ospf_neighbor *nbr, struct list *update, int flag,
 	else
 		route_unlock_node(rn);
 
+	return rn->info;
+}
+
+void ospf_ls_upd_send(struct ospf_neighbor *nbr, struct list *update, int flag,
+		      int send_lsupd_now)
+{
+	struct ospf_interface *oi;
+	struct ospf_lsa *lsa;
+	struct route_node *rn;
+	struct listnode *node;
+	struct list *queue;
+
+	oi = nbr->oi;
+
+	queue = ospf_ls_upd_queue_get(oi, ospf_ls_upd_dst(nbr, flag));
+
 	for (ALL_LIST_ELEMENTS_RO(update, node, lsa))
-		listnode_add(rn->info,
-			     ospf_lsa_lock(lsa)); /* oi->ls_upd_queue */
+		listnode_add(queue, ospf_lsa_lock(lsa)); /* oi->ls_upd_queue */
 	if (send_lsupd_now) {
 		struct list *send_update_list;
 		struct route_node *rnext;
@@ -3934,6 +3946,36 @@ void ospf_ls_upd_send(struct ospf_neighbor *nbr, struct list *update, int flag,
 				&oi->t_ls_upd_event);
 }
 
+/* Send Link State Update with an LSA. */
+void ospf_ls_upd_send_lsa(struct ospf_neighbor *nbr, struct ospf_lsa *lsa,
+			  int flag)
+{
+	struct ospf_interface *oi = nbr->oi;
+	struct list *update;
+
+	/*ospf instance is going down, send self originated
+	 * MAXAGE LSA update to neighbors to remove from LSDB */
+	if (oi->ospf->inst_shutdown && IS_LSA_MAXAGE(lsa)) {
+		update = list_new();
+		listnode_add(update, lsa);
+		ospf_ls_upd_send(nbr, update, flag, 1);
+		list_delete(&update);
+		return;
+	}
+
+	/*
+	 * Flooding calls this once per LSA and interface; queue the LSA
+	 * directly instead of going through a temporary list, so that a
+	 * large reflood costs one queue append per LSA. The queue event
+	 * then packs the LSAs into as few LS Updates as the MTU allows.
+	 */
+	update = ospf_ls_upd_queue_get(oi, ospf_ls_upd_dst(nbr, flag));
+	listnode_add(update, ospf_lsa_lock(lsa)); /* oi->ls_upd_queue */
+
+	event_add_event(master, ospf_ls_upd_send_queue_event, oi, 0,
+			&oi->t_ls_upd_event);
+}
+
 static void ospf_ls_ack_send_list(struct ospf_interface *oi, struct list *ack,
 				  struct in_addr dst)
 {
@@ -95,11 +95,20 @@ static int test(FILE *input, FILE *output)
 		return 1;
 	}
 
+	stream_set_getp(s, 0);
+	struct isis_tlv_view view;
+	const char *view_log;
+	int view_rv = isis_tlv_view_init(&view, s, STREAM_READABLE(s),
+					 &view_log);
+
 	stream_set_getp(s, 0);
 	struct isis_tlvs *tlvs;
 	const char *log;
 	int rv = isis_unpack_tlvs(STREAM_READABLE(s), s, &tlvs, &log);
 
+	/* A PDU whose TLV framing is broken can't be unpacked either */
+	assert(!view_rv || rv);
+
 	if (rv) {
 		fprintf(output, "Could not unpack TLVs:\n%s\n", log);
 		isis_free_tlvs(tlvs);
@@ -111,6 +120,31 @@ static int test(FILE *input, FILE *output)
 	const char *s_tlvs = isis_format_tlvs(tlvs, NULL);
 	fprintf(output, "Unpacked TLVs:\n%s", s_tlvs);
 
+	/* Decoding through the lazy view must give the same result, both
+	 * all at once and type by type */
+	assert(!view_rv);
+	char *unpacked_tlvs = XSTRDUP(MTYPE_TMP, s_tlvs);
+	struct isis_tlvs *view_tlvs = NULL;
+
+	rv = isis_tlv_view_unpack_all(&view, &view_tlvs, &view_log);
+	assert(!rv);
+	assert(!strcmp(unpacked_tlvs, isis_format_tlvs(view_tlvs, NULL)));
+	isis_free_tlvs(view_tlvs);
+
+	view_tlvs = NULL;
+	for (int type = 0; type < ISIS_TLV_MAX; type++) {
+		if (!isis_tlv_view_has(&view, type))
+			continue;
+		rv = isis_tlv_view_unpack(&view, type, &view_tlvs, &view_log);
+		assert(!rv);
+	}
+	/* Content that fails to encode always counts as changed, so only
+	 * compare if the TLVs are found unchanged against themselves */
+	if (view_tlvs && !isis_tlvs_diff(tlvs, tlvs))
+		assert(!isis_tlvs_diff(tlvs, view_tlvs));
+	isis_free_tlvs(view_tlvs);
+	XFREE(MTYPE_TMP, unpacked_tlvs);
+
 	struct isis_item *orig_auth = tlvs->isis_auth.head;
 	tlvs->isis_auth.head = NULL;
 	s_tlvs = isis_format_tlvs(tlvs, NULL);
@@ -152,6 +152,43 @@ int main(int argc, char **argv)
 	assert(!strcmp(chloroplast, "eetr"));
 	printf("Retrieved: '%s'\n", chloroplast);
 
+	ringbuf_wipe(soil);
+
+	/* validate direct write across ring boundary */
+	soil->start = soil->size - 2;
+	soil->end = soil->start;
+	struct iovec sap[2];
+	printf("Validating direct write...\n");
+	assert(ringbuf_space_iov(soil, sap) == 2);
+	assert(sap[0].iov_len == 2);
+	assert(sap[1].iov_len == soil->size - 2);
+	memcpy(sap[0].iov_base, "le", 2);
+	memcpy(sap[1].iov_base, "af", 2);
+	assert(ringbuf_commit(soil, 4) == 4);
+	validate_state(soil, BUFSIZ, 4);
+	char bud[5];
+	assert(ringbuf_get(soil, bud, sizeof(bud)) == 4);
+	bud[4] = '\0';
+	assert(!strcmp(bud, "leaf"));
+	printf("Retrieved: '%s'\n", bud);
+
+	/* free space before start does not wrap */
+	ringbuf_reset(soil);
+	assert(ringbuf_put(soil, compost, BUFSIZ - 1) == BUFSIZ - 1);
+	assert(ringbuf_get(soil, bud, 3) == 3);
+	assert(ringbuf_space_iov(soil, sap) == 2);
+	assert(ringbuf_commit(soil, 2) == 2);
+	assert(soil->end == 1);
+	assert(ringbuf_space_iov(soil, sap) == 1);
+	assert(sap[0].iov_len == 2);
+	assert(ringbuf_commit(soil, 3) == 2);
+	validate_state(soil, BUFSIZ, BUFSIZ);
+
+	/* nothing to describe in a full buffer */
+	assert(ringbuf_space_iov(soil, sap) == 0);
+	assert(ringbuf_commit(soil, 1) == 0);
+	validate_state(soil, BUFSIZ, BUFSIZ);
+
 	printf("Deleting...\n");
 	ringbuf_del(soil);
 
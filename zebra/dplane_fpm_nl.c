@@ -113,6 +113,20 @@ struct fpm_nl_ctx {
 	struct event *t_rmacreset;
 	struct event *t_rmacwalk;
 
+	/*
+	 * RIB walk position: the iterator is kept one step behind so it
+	 * yields the table being walked again, and `rib_resume` holds the
+	 * prefix to pick up from in that table (AF_UNSPEC when starting it).
+	 * Tables may come and go between runs, so the table `rib_resume`
+	 * belongs to is recorded as well.
+	 */
+	rib_tables_iter_t rib_iter;
+	struct prefix rib_resume;
+	vrf_id_t rib_resume_vrf_id;
+	afi_t rib_resume_afi;
+	safi_t rib_resume_safi;
+	uint32_t rib_resume_table_id;
+
 	/* Statistic counters. */
 	struct {
 		/* Amount of bytes read into ibuf. */
@@ -1235,6 +1249,10 @@ static void fpm_nhg_send(struct event *t)
 
 /**
  * Send all RIB installed routes to the connected data plane.
+ *
+ * When the output buffer fills up the walk stops and is resumed later from
+ * the route it stopped at, instead of walking again all the routes that were
+ * already sent.
  */
 static void fpm_rib_send(struct event *t)
 {
@@ -1244,13 +1262,38 @@ static void fpm_rib_send(struct event *t)
 	struct route_table *rt;
 	struct zebra_dplane_ctx *ctx;
 	rib_tables_iter_t rt_iter;
+	struct rib_table_info *info;
+	const struct prefix *p;
 
 	/* Allocate temporary context for all transactions. */
 	ctx = dplane_ctx_alloc();
 
-	rt_iter.state = RIB_TABLES_ITER_S_INIT;
-	while ((rt = rib_tables_iter_next(&rt_iter))) {
-		for (rn = route_top(rt); rn; rn = srcdest_route_next(rn)) {
+	while (true) {
+		rt_iter = fnc->rib_iter;
+		rt = rib_tables_iter_next(&rt_iter);
+		if (rt == NULL)
+			break;
+
+		/*
+		 * The resume prefix only applies to the table we stopped in;
+		 * if tables changed meanwhile, walk this one from the top.
+		 */
+		info = rib_table_info(rt);
+		if (zvrf_id(info->zvrf) != fnc->rib_resume_vrf_id ||
+		    info->afi != fnc->rib_resume_afi ||
+		    info->safi != fnc->rib_resume_safi ||
+		    info->table_id != fnc->rib_resume_table_id)
+			fnc->rib_resume.family = AF_UNSPEC;
+
+		if (fnc->rib_resume.family == AF_UNSPEC)
+			rn = route_top(rt);
+		else {
+			rn = route_node_lookup(rt, &fnc->rib_resume);
+			if (rn == NULL)
+				rn = route_table_get_next(rt, &fnc->rib_resume);
+		}
+
+		for (; rn; rn = srcdest_route_next(rn)) {
 			dest = rib_dest_from_rnode(rn);
 			/* Skip bad route entries. */
 			if (dest == NULL || dest->selected_fib == NULL)
@@ -1265,6 +1308,15 @@ static void fpm_rib_send(struct event *t)
 			dplane_ctx_route_init(ctx, DPLANE_OP_ROUTE_INSTALL, rn,
 					      dest->selected_fib);
 			if (fpm_nl_enqueue(fnc, ctx) == -1) {
+				/* Remember where to continue from. */
+				srcdest_rnode_prefixes(rn, &p, NULL);
+				prefix_copy(&fnc->rib_resume, p);
+				fnc->rib_resume_vrf_id = zvrf_id(info->zvrf);
+				fnc->rib_resume_afi = info->afi;
+				fnc->rib_resume_safi = info->safi;
+				fnc->rib_resume_table_id = info->table_id;
+				route_unlock_node(rn);
+
 				/* Free the temporary allocated context. */
 				dplane_ctx_fini(&ctx);
 
@@ -1276,6 +1328,10 @@ static void fpm_rib_send(struct event *t)
 			/* Mark as sent. */
 			SET_FLAG(dest->flags, RIB_DEST_UPDATE_FPM);
 		}
+
+		/* Table done, move onto the next one. */
+		fnc->rib_iter = rt_iter;
+		fnc->rib_resume.family = AF_UNSPEC;
 	}
 
 	/* Free the temporary allocated context. */
@@ -1421,6 +1477,10 @@ static void fpm_rib_reset(struct event *t)
 		}
 	}
 
+	/* Start the send walk from the first table. */
+	rib_tables_iter_init(&fnc->rib_iter);
+	fnc->rib_resume.family = AF_UNSPEC;
+
 	/* Schedule next step: send RIB routes. */
 	event_add_event(zrouter.master, fpm_rib_send, fnc, 0, &fnc->t_ribwalk);
 }
@@ -28,6 +28,7 @@
 #include <assert.h>
 #include <err.h>
 #include <sys/types.h>
+#include <time.h>
 
 #include <linux/netlink.h>
 #include <linux/rtnetlink.h>
@@ -44,6 +45,7 @@ struct glob {
 	int sock;
 	bool reflect;
 	bool dump_hex;
+	bool bench;
 };
 
 struct glob glob_space;
@@ -763,6 +765,89 @@ static void fpm_serve(void)
 	}
 }
 
+static double timespec_diff(const struct timespec *a, const struct timespec *b)
+{
+	return (double)(a->tv_sec - b->tv_sec) +
+	       (double)(a->tv_nsec - b->tv_nsec) / 1e9;
+}
+
+/*
+ * fpm_bench
+ *
+ * Drain the connection as fast as possible, only splitting the stream into
+ * FPM messages, and report the rate they arrive at once per second and when
+ * the client disconnects.
+ */
+static void fpm_bench(void)
+{
+	char buf[FPM_MAX_MSG_LEN * 16];
+	size_t have = 0, off, msg_len;
+	ssize_t bytes_read;
+	fpm_msg_hdr_t *hdr;
+	uint64_t msgs = 0, bytes = 0, last_msgs = 0, last_bytes = 0;
+	struct timespec start, last, now;
+	double elapsed;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	last = start;
+
+	while (1) {
+		bytes_read = read(glob->sock, buf + have, sizeof(buf) - have);
+		if (bytes_read == 0)
+			break;
+
+		if (bytes_read < 0) {
+			if (errno == EINTR)
+				continue;
+
+			fprintf(stderr, "Error reading from socket: %s\n",
+				strerror(errno));
+			break;
+		}
+
+		have += bytes_read;
+		bytes += bytes_read;
+
+		/* Count the complete messages, keep the partial one. */
+		off = 0;
+		while (have - off >= FPM_MSG_HDR_LEN) {
+			hdr = (fpm_msg_hdr_t *)(buf + off);
+			msg_len = fpm_msg_len(hdr);
+			if (msg_len < FPM_MSG_HDR_LEN || msg_len > sizeof(buf)) {
+				fprintf(stderr, "Malformed fpm message\n");
+				return;
+			}
+
+			if (have - off < msg_len)
+				break;
+
+			off += msg_len;
+			msgs++;
+		}
+
+		memmove(buf, buf + off, have - off);
+		have -= off;
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		elapsed = timespec_diff(&now, &last);
+		if (elapsed >= 1.0) {
+			fprintf(stdout, "%.0f msgs/s, %.0f bytes/s\n",
+				(msgs - last_msgs) / elapsed,
+				(bytes - last_bytes) / elapsed);
+			last_msgs = msgs;
+			last_bytes = bytes;
+			last = now;
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	elapsed = timespec_diff(&now, &start);
+	fprintf(stdout,
+		"Received %" PRIu64 " messages, %" PRIu64
+		" bytes in %.3f seconds (%.0f msgs/s)\n",
+		msgs, bytes, elapsed, elapsed > 0 ? msgs / elapsed : 0);
+}
+
 int main(int argc, char **argv)
 {
 	pid_t daemon;
@@ -771,7 +856,7 @@ int main(int argc, char **argv)
 
 	memset(glob, 0, sizeof(*glob));
 
-	while ((r = getopt(argc, argv, "rdv")) != -1) {
+	while ((r = getopt(argc, argv, "rdvb")) != -1) {
 		switch (r) {
 		case 'r':
 			glob->reflect = true;
@@ -782,6 +867,9 @@ int main(int argc, char **argv)
 		case 'v':
 			glob->dump_hex = true;
 			break;
+		case 'b':
+			glob->bench = true;
+			break;
 		}
 	}
 
@@ -800,7 +888,10 @@ int main(int argc, char **argv)
 	 */
 	while (1) {
 		glob->sock = accept_conn(glob->server_sock);
-		fpm_serve();
+		if (glob->bench)
+			fpm_bench();
+		else
+			fpm_serve();
 		fprintf(stdout, "Done serving client");
 	}
 }
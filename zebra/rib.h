@@ -194,6 +194,19 @@ struct meta_queue {
 	uint32_t size; /* sum of lengths of all subqueues */
 };
 
+/*
+ * Route sub-queues do not hold route nodes directly, but one of these per
+ * VRF with route nodes pending in that sub-queue. VRFs are served
+ * round-robin, one route node at a time, so that churn in one VRF does not
+ * hold back route processing in all the others. Within a VRF, route nodes
+ * are processed in the order they were queued.
+ */
+struct meta_queue_vrf {
+	struct zebra_vrf *zvrf;
+	struct list *nodes[MQ_SIZE];
+	uint32_t size; /* route nodes queued over all sub-queues */
+};
+
 /*
  * Structure that represents a single destination (prefix).
  */
@@ -414,7 +427,9 @@ extern void rib_update(enum rib_update_event event);
 extern void rib_update_table(struct route_table *table,
 			     enum rib_update_event event, int rtype);
 extern void rib_sweep_route(struct event *t);
-extern void rib_sweep_table(struct route_table *table);
+extern struct route_node *rib_sweep_table_batch(struct route_table *table,
+						struct route_node *rn,
+						uint32_t *budget);
 extern void rib_close_table(struct route_table *table);
 extern void zebra_rib_init(void);
 extern void zebra_rib_terminate(void);
@@ -591,6 +591,17 @@ parse_nexthop_unicast(ns_id_t ns_id, struct rtmsg *rtm, struct rtattr **tb,
 	return nh;
 }
 
+/*
+ * Free what parse_nexthop_unicast() may have attached to a nexthop that
+ * lives on the stack.
+ */
+static void netlink_nexthop_release(struct nexthop *nh)
+{
+	nexthop_del_labels(nh);
+	nexthop_del_srv6_seg6local(nh);
+	nexthop_del_srv6_seg6(nh);
+}
+
 static uint8_t parse_multipath_nexthops_unicast(ns_id_t ns_id,
 						struct nexthop_group *ng,
 						struct rtmsg *rtm,
@@ -977,24 +988,30 @@ int netlink_route_change_read_unicast_internal(struct nlmsghdr *h,
 	if (h->nlmsg_type == RTM_NEWROUTE) {
 		struct route_entry *re;
 		struct nexthop_group *ng = NULL;
+		struct nexthop_group nhg_single = {};
+		struct nexthop nh;
 
 		re = zebra_rib_route_entry_new(vrf_id, proto, 0, flags, nhe_id,
 					       table, metric, mtu, distance,
 					       tag);
-		if (!nhe_id)
+		if (!nhe_id && tb[RTA_MULTIPATH])
 			ng = nexthop_group_new();
 
 		if (!tb[RTA_MULTIPATH]) {
-			struct nexthop *nexthop, nh;
-
-			if (!nhe_id) {
-				nh = parse_nexthop_unicast(
-					ns_id, rtm, tb, bh_type, index, prefsrc,
-					gate, afi, vrf_id);
-
-				nexthop = nexthop_new();
-				*nexthop = nh;
-				nexthop_group_add_sorted(ng, nexthop);
+			/*
+			 * Single path routes make up the bulk of a kernel
+			 * table dump.  The nexthop is copied into the nhe by
+			 * rib_add_multipath(), and not used at all when a
+			 * dplane context is handed in, so it can live on the
+			 * stack.
+			 */
+			if (!nhe_id && !ctx) {
+				nh = parse_nexthop_unicast(ns_id, rtm, tb,
+							   bh_type, index,
+							   prefsrc, gate, afi,
+							   vrf_id);
+				nhg_single.nexthop = &nh;
+				ng = &nhg_single;
 			}
 		} else {
 			/* This is a multipath route */
@@ -1022,10 +1039,12 @@ int netlink_route_change_read_unicast_internal(struct nlmsghdr *h,
 				}
 			}
 		}
-		if (nhe_id || ng) {
+		if (nhe_id || ng || (ctx && !tb[RTA_MULTIPATH])) {
 			dplane_rib_add_multipath(afi, SAFI_UNICAST, &p, &src_p,
 						 re, ng, startup, ctx);
-			if (ng)
+			if (ng == &nhg_single)
+				netlink_nexthop_release(&nh);
+			else if (ng)
 				nexthop_group_delete(&ng);
 			if (ctx)
 				zebra_rib_route_entry_free(re);
@@ -1064,6 +1083,7 @@ int netlink_route_change_read_unicast_internal(struct nlmsghdr *h,
 				rib_delete(afi, SAFI_UNICAST, vrf_id, proto, 0,
 					   flags, &p, &src_p, &nh, 0, table,
 					   metric, distance, true);
+				netlink_nexthop_release(&nh);
 			} else {
 				/* XXX: need to compare the entire list of
 				 * nexthops here for NLM_F_APPEND stupidity */
@@ -60,6 +60,16 @@ const uint32_t DPLANE_DEFAULT_MAX_QUEUED = 200;
 /* Default value for new work per cycle */
 const uint32_t DPLANE_DEFAULT_NEW_WORK = 100;
 
+/* Upper bound for new work per cycle while a backlog is being drained */
+const uint32_t DPLANE_MAX_NEW_WORK = 1600;
+
+/* Buckets of the per-provider latency histogram, in microseconds */
+static const int64_t dplane_latency_bounds[] = {
+	100, 1000, 10000, 100000, 1000000,
+};
+
+#define DPLANE_LATENCY_BUCKETS (array_size(dplane_latency_bounds) + 1)
+
 /* Validation check macro for context blocks */
 /* #define DPLANE_DEBUG 1 */
 
@@ -409,6 +419,9 @@ struct zebra_dplane_ctx {
 	char zd_ifname[IFNAMSIZ];
 	ifindex_t zd_ifindex;
 
+	/* Time the context was handed to the current provider */
+	struct timeval zd_prov_time;
+
 	/* Support info for different kinds of updates */
 	union {
 		struct dplane_route_info rinfo;
@@ -490,6 +503,9 @@ struct zebra_dplane_provider {
 	_Atomic uint32_t dp_out_max;
 	_Atomic uint32_t dp_error_counter;
 
+	/* Time from handing a context to the provider until it comes back */
+	_Atomic uint32_t dp_latency[DPLANE_LATENCY_BUCKETS];
+
 	/* Queue of contexts inbound to the provider */
 	struct dplane_ctx_list_head dp_ctx_in_list;
 
@@ -556,9 +572,11 @@ static struct zebra_dplane_globals {
 	bool dg_sys_route_notifs;
 
 	/* Limit number of new updates dequeued at once, to pace an
-	 * incoming burst.
+	 * incoming burst. This grows while there is a backlog and shrinks
+	 * back once it has been drained, see dplane_work_limit_adjust().
 	 */
-	uint32_t dg_updates_per_cycle;
+	_Atomic uint32_t dg_updates_per_cycle;
+	_Atomic uint32_t dg_updates_per_cycle_max;
 
 	_Atomic uint32_t dg_routes_in;
 	_Atomic uint32_t dg_routes_queued;
@@ -6103,6 +6121,7 @@ int dplane_show_provs_helper(struct vty *vty, bool detailed)
 {
 	struct zebra_dplane_provider *prov;
 	uint64_t in, in_q, in_max, out, out_q, out_max;
+	uint32_t i;
 
 	vty_out(vty, "Zebra dataplane providers:\n");
 
@@ -6130,9 +6149,32 @@ int dplane_show_provs_helper(struct vty *vty, bool detailed)
 			prov->dp_name, prov->dp_id, in, in_q, in_max,
 			out, out_q, out_max);
 
+		if (detailed) {
+			vty_out(vty, "  latency:");
+			for (i = 0; i < DPLANE_LATENCY_BUCKETS; i++) {
+				if (i < array_size(dplane_latency_bounds))
+					vty_out(vty, " <%" PRId64 "us: ",
+						dplane_latency_bounds[i]);
+				else
+					vty_out(vty, " more: ");
+
+				vty_out(vty, "%u",
+					atomic_load_explicit(&prov->dp_latency[i],
+							     memory_order_relaxed));
+			}
+			vty_out(vty, "\n");
+		}
+
 		prov = dplane_prov_list_next(&zdplane_info.dg_providers, prov);
 	}
 
+	if (detailed)
+		vty_out(vty, "Work per cycle: %u, max: %u\n",
+			atomic_load_explicit(&zdplane_info.dg_updates_per_cycle,
+					     memory_order_relaxed),
+			atomic_load_explicit(&zdplane_info.dg_updates_per_cycle_max,
+					     memory_order_relaxed));
+
 	return CMD_SUCCESS;
 }
 
@@ -6245,7 +6287,8 @@ void *dplane_provider_get_data(const struct zebra_dplane_provider *prov)
 
 int dplane_provider_get_work_limit(const struct zebra_dplane_provider *prov)
 {
-	return zdplane_info.dg_updates_per_cycle;
+	return atomic_load_explicit(&zdplane_info.dg_updates_per_cycle,
+				    memory_order_relaxed);
 }
 
 /* Lock/unlock a provider's mutex - iff the provider was registered with
@@ -6293,7 +6336,7 @@ int dplane_provider_dequeue_in_list(struct zebra_dplane_provider *prov,
 	int limit, ret;
 	struct zebra_dplane_ctx *ctx;
 
-	limit = zdplane_info.dg_updates_per_cycle;
+	limit = dplane_provider_get_work_limit(prov);
 
 	dplane_provider_lock(prov);
 
@@ -7291,6 +7334,62 @@ void zebra_dplane_finish(void)
 			NULL, 0, &zdplane_info.dg_t_shutdown_check);
 }
 
+/*
+ * Account the time a provider spent on a context, from the moment it was
+ * handed to the provider until it was dequeued from its output queue.
+ */
+static void dplane_provider_latency_add(struct zebra_dplane_provider *prov,
+					const struct zebra_dplane_ctx *ctx,
+					const struct timeval *now)
+{
+	struct timeval diff;
+	int64_t usecs;
+	uint32_t i;
+
+	/* Contexts originated by the provider itself are not timed. */
+	if (!timerisset(&ctx->zd_prov_time))
+		return;
+
+	timersub(now, &ctx->zd_prov_time, &diff);
+	usecs = diff.tv_sec * 1000000LL + diff.tv_usec;
+
+	for (i = 0; i < array_size(dplane_latency_bounds); i++)
+		if (usecs < dplane_latency_bounds[i])
+			break;
+
+	atomic_fetch_add_explicit(&prov->dp_latency[i], 1,
+				  memory_order_relaxed);
+}
+
+/*
+ * Adapt the amount of work taken per cycle: double it while work is left
+ * behind at the end of a cycle, so a bulk load is drained in fewer, larger
+ * cycles, and halve it back towards the default once cycles are no longer
+ * full so that the loop returns to servicing i/o promptly.
+ */
+static void dplane_work_limit_adjust(int limit, int new_work, bool backlog)
+{
+	uint32_t next = limit;
+
+	if (backlog)
+		next = MIN((uint32_t)limit * 2, DPLANE_MAX_NEW_WORK);
+	else if (new_work < limit / 2)
+		next = MAX((uint32_t)limit / 2, DPLANE_DEFAULT_NEW_WORK);
+
+	if (next == (uint32_t)limit)
+		return;
+
+	if (IS_ZEBRA_DEBUG_DPLANE_DETAIL)
+		zlog_debug("dplane: work per cycle %d -> %u", limit, next);
+
+	atomic_store_explicit(&zdplane_info.dg_updates_per_cycle, next,
+			      memory_order_relaxed);
+	if (next > atomic_load_explicit(&zdplane_info.dg_updates_per_cycle_max,
+					memory_order_relaxed))
+		atomic_store_explicit(&zdplane_info.dg_updates_per_cycle_max,
+				      next, memory_order_relaxed);
+}
+
 /*
  * Main dataplane pthread event loop. The thread takes new incoming work
  * and offers it to the first provider. It then iterates through the
@@ -7308,12 +7407,15 @@ static void dplane_thread_loop(struct event *event)
 	struct dplane_ctx_list_head error_list;
 	struct zebra_dplane_provider *prov;
 	struct zebra_dplane_ctx *ctx;
-	int limit, counter, error_counter;
+	int limit, counter, error_counter, new_work;
 	uint64_t curr, high;
 	bool reschedule = false;
+	bool backlog;
+	struct timeval now;
 
 	/* Capture work limit per cycle */
-	limit = zdplane_info.dg_updates_per_cycle;
+	limit = atomic_load_explicit(&zdplane_info.dg_updates_per_cycle,
+				     memory_order_relaxed);
 
 	/* Init temporary lists used to move contexts among providers */
 	dplane_ctx_list_init(&work_list);
@@ -7345,8 +7447,12 @@ static void dplane_thread_loop(struct event *event)
 		}
 	}
 
+	backlog = dplane_ctx_list_count(&zdplane_info.dg_update_list) > 0;
+
 	DPLANE_UNLOCK();
 
+	new_work = counter;
+
 	atomic_fetch_sub_explicit(&zdplane_info.dg_routes_queued, counter,
 				  memory_order_relaxed);
 
@@ -7369,10 +7475,13 @@ static void dplane_thread_loop(struct event *event)
 		/* Capture current provider id in each context; check for
 		 * error status.
 		 */
+		monotime(&now);
+
 		frr_each_safe (dplane_ctx_list, &work_list, ctx) {
 			if (dplane_ctx_get_status(ctx) ==
 			    ZEBRA_DPLANE_REQUEST_SUCCESS) {
 				ctx->zd_provider = prov->dp_id;
+				ctx->zd_prov_time = now;
 			} else {
 				/*
 				 * TODO -- improve error-handling: recirc
@@ -7426,11 +7535,16 @@ static void dplane_thread_loop(struct event *event)
 			break;
 
 		/* Dequeue completed work from the provider */
+		monotime(&now);
+
 		dplane_provider_lock(prov);
 
 		while (counter < limit) {
 			ctx = dplane_provider_dequeue_out_ctx(prov);
 			if (ctx) {
+				dplane_provider_latency_add(prov, ctx, &now);
+				timerclear(&ctx->zd_prov_time);
+
 				dplane_ctx_list_add_tail(&work_list, ctx);
 				counter++;
 			} else
@@ -7439,8 +7553,10 @@ static void dplane_thread_loop(struct event *event)
 
 		dplane_provider_unlock(prov);
 
-		if (counter >= limit)
+		if (counter >= limit) {
 			reschedule = true;
+			backlog = true;
+		}
 
 		if (IS_ZEBRA_DEBUG_DPLANE_DETAIL)
 			zlog_debug("dplane dequeues %d completed work from provider %s",
@@ -7462,6 +7578,8 @@ static void dplane_thread_loop(struct event *event)
 	if (reschedule)
 		dplane_provider_work_ready();
 
+	dplane_work_limit_adjust(limit, new_work, backlog);
+
 	/* After all providers have been serviced, enqueue any completed
 	 * work and any errors back to zebra so it can process the results.
 	 */
@@ -7556,6 +7674,7 @@ static void zebra_dplane_init_internal(void)
 	zns_info_list_init(&zdplane_info.dg_zns_list);
 
 	zdplane_info.dg_updates_per_cycle = DPLANE_DEFAULT_NEW_WORK;
+	zdplane_info.dg_updates_per_cycle_max = DPLANE_DEFAULT_NEW_WORK;
 
 	zdplane_info.dg_max_queued_updates = DPLANE_DEFAULT_MAX_QUEUED;
 
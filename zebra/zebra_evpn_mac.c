@@ -1039,6 +1039,7 @@ struct zebra_mac *zebra_evpn_mac_add(struct zebra_evpn *zevpn,
 	mac->dad_mac_auto_recovery_timer = NULL;
 
 	mac->neigh_list = list_new();
+	listset_app_node_mem(mac->neigh_list);
 	mac->neigh_list->cmp = neigh_list_cmp;
 
 	mac->uptime = monotime(NULL);
@@ -105,7 +105,9 @@ struct zebra_mac {
 	uint32_t rem_seq;
 	uint32_t loc_seq;
 
-	/* List of neigh associated with this mac */
+	/* List of neigh associated with this mac, linked through the
+	 * neigh's own mac_listnode.
+	 */
 	struct list *neigh_list;
 
 	/* List of nexthop associated with this RMAC */
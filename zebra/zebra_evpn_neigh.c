@@ -208,7 +208,8 @@ static void zebra_evpn_local_neigh_ref_mac(struct zebra_neigh *n,
 	if (!mac)
 		return;
 
-	listnode_add_sort(mac->neigh_list, n);
+	listnode_init(&n->mac_listnode, n);
+	listnode_add_sort(mac->neigh_list, &n->mac_listnode);
 	if (n->flags & ZEBRA_NEIGH_ALL_PEER_FLAGS) {
 		old_static = zebra_evpn_mac_is_static(mac);
 		++mac->sync_neigh_cnt;
@@ -2095,8 +2096,13 @@ void zebra_evpn_neigh_remote_macip_add(struct zebra_evpn *zevpn,
 					n->mac = NULL;
 					zebra_evpn_deref_ip2mac(zevpn, old_mac);
 				}
+				/* the neigh can only be on one mac's list */
+				if (n->mac)
+					listnode_delete(n->mac->neigh_list, n);
 				n->mac = mac;
-				listnode_add_sort(mac->neigh_list, n);
+				listnode_init(&n->mac_listnode, n);
+				listnode_add_sort(mac->neigh_list,
+						  &n->mac_listnode);
 				memcpy(&n->emac, &mac->macaddr, ETH_ALEN);
 
 				/* Check Neigh's curent state is local
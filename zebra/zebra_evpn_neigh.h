@@ -41,6 +41,8 @@ struct zebra_neigh {
 
 	/* Back pointer to MAC. Only applicable to hosts in a L2-VNI. */
 	struct zebra_mac *mac;
+	/* memory used to link the neigh to the mac's neigh_list */
+	struct listnode mac_listnode;
 
 	/* Underlying interface. */
 	ifindex_t ifindex;
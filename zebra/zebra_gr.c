@@ -80,7 +80,6 @@ void zebra_gr_stale_client_cleanup(struct list *client_list)
 			/* Cancel the stale timer */
 			if (info->t_stale_removal != NULL) {
 				EVENT_OFF(info->t_stale_removal);
-				info->do_delete = true;
 				/* Process the stale routes */
 				event_execute(
 					zrouter.master,
@@ -123,7 +122,6 @@ static void zebra_gr_client_info_delete(struct zserv *client,
 	       info->vrf_id);
 
 	/* Delete all the stale routes. */
-	info->do_delete = true;
 	zebra_gr_delete_stale_routes(info);
 
 	XFREE(MTYPE_ZEBRA_GR, info);
@@ -286,10 +284,15 @@ void zebra_gr_client_reconnect(struct zserv *client)
 }
 
 struct zebra_gr_afi_clean {
-	struct client_gr_info *info;
+	vrf_id_t vrf_id;
 	afi_t afi;
 	uint8_t proto;
 	uint8_t instance;
+	time_t restart_time;
+
+	/* Table being walked and the (locked) node to resume from */
+	struct route_table *table;
+	struct route_node *rn;
 
 	struct event *t_gac;
 };
@@ -486,15 +489,15 @@ static void zebra_gr_route_stale_delete_timer_expiry(struct event *thread)
  *
  * Returns true when a node is deleted else false
  */
-static bool zebra_gr_process_route_entry(struct zserv *client,
+static bool zebra_gr_process_route_entry(struct zebra_gr_afi_clean *gac,
 					 struct route_node *rn,
 					 struct route_entry *re)
 {
 	/* If the route is not refreshed after restart, delete the entry */
-	if (re->uptime < client->restart_time) {
+	if (re->uptime < gac->restart_time) {
 		if (IS_ZEBRA_DEBUG_RIB)
 			zlog_debug("%s: Client %s stale route %pFX is deleted",
-				   __func__, zebra_route_string(client->proto),
+				   __func__, zebra_route_string(gac->proto),
 				   &rn->p);
 		rib_delnode(rn, re);
 
@@ -504,13 +507,18 @@ static bool zebra_gr_process_route_entry(struct zserv *client,
 	return false;
 }
 
+/*
+ * Walk the table and delete the stale routes of the client, looking at
+ * no more than ZEBRA_MAX_STALE_ROUTE_COUNT route entries per run so that
+ * a large table does not hold up everything else.
+ */
 static void zebra_gr_delete_stale_route_table_afi(struct event *event)
 {
 	struct zebra_gr_afi_clean *gac = EVENT_ARG(event);
 	struct route_table *table;
 	struct route_node *rn;
 	struct route_entry *re, *next;
-	struct zebra_vrf *zvrf = zebra_vrf_lookup_by_id(gac->info->vrf_id);
+	struct zebra_vrf *zvrf = zebra_vrf_lookup_by_id(gac->vrf_id);
 	int32_t n = 0;
 
 	if (!zvrf)
@@ -520,8 +528,33 @@ static void zebra_gr_delete_stale_route_table_afi(struct event *event)
 	if (!table)
 		goto done;
 
-	for (rn = route_top(table); rn; rn = srcdest_route_next(rn)) {
+	/*
+	 * Only resume if we are still looking at the same table, otherwise
+	 * it went away together with the node we held.
+	 */
+	if (gac->rn && gac->table != table)
+		goto done;
+
+	rn = gac->rn ? gac->rn : route_top(table);
+	gac->table = table;
+	gac->rn = NULL;
+
+	for (; rn; rn = srcdest_route_next(rn)) {
+		/*
+		 * Yield, resuming from this node right after whatever
+		 * else is pending, so the stale routes do not linger.
+		 */
+		if (n >= ZEBRA_MAX_STALE_ROUTE_COUNT) {
+			gac->rn = rn;
+			event_add_event(zrouter.master,
+					zebra_gr_delete_stale_route_table_afi,
+					gac, 0, &gac->t_gac);
+			return;
+		}
+
 		RNODE_FOREACH_RE_SAFE (rn, re, next) {
+			n++;
+
 			if (CHECK_FLAG(re->status, ROUTE_ENTRY_REMOVED))
 				continue;
 
@@ -529,25 +562,9 @@ static void zebra_gr_delete_stale_route_table_afi(struct event *event)
 			 * after restart then do not delete
 			 * the route
 			 */
-
 			if (re->type == gac->proto &&
-			    re->instance == gac->instance &&
-			    zebra_gr_process_route_entry(
-				    gac->info->stale_client_ptr, rn, re))
-				n++;
-
-			/* If the max route count is reached
-			 * then timer thread will be restarted
-			 * Store the current prefix and afi
-			 */
-			if ((n >= ZEBRA_MAX_STALE_ROUTE_COUNT) &&
-			    (gac->info->do_delete == false)) {
-				event_add_timer(
-					zrouter.master,
-					zebra_gr_delete_stale_route_table_afi,
-					gac, ZEBRA_DEFAULT_STALE_UPDATE_DELAY,
-					&gac->t_gac);
-			}
+			    re->instance == gac->instance)
+				zebra_gr_process_route_entry(gac, rn, re);
 		}
 	}
 
@@ -671,11 +688,18 @@ void zebra_gr_process_client(afi_t afi, vrf_id_t vrf_id, uint8_t proto,
 	if (info == NULL)
 		return;
 
+	/*
+	 * The walk may outlive the client info, so copy what it needs
+	 * rather than pointing at it.
+	 */
 	gac = XCALLOC(MTYPE_ZEBRA_GR, sizeof(*gac));
-	gac->info = info;
+	gac->vrf_id = vrf_id;
 	gac->afi = afi;
 	gac->proto = proto;
 	gac->instance = instance;
+	if (info->stale_client_ptr)
+		client = info->stale_client_ptr;
+	gac->restart_time = client->restart_time;
 
 	event_add_event(zrouter.master, zebra_gr_delete_stale_route_table_afi,
 			gac, 0, &gac->t_gac);
@@ -424,6 +424,7 @@ static void *zebra_nhg_hash_alloc(void *arg)
 	struct nhg_hash_entry *copy = arg;
 
 	nhe = zebra_nhe_copy(copy, copy->id);
+	nhe->hash_key = copy->hash_key;
 
 	/* Mark duplicate nexthops in a group at creation time. */
 	nexthop_group_mark_duplicates(&(nhe->nhg));
@@ -453,9 +454,8 @@ static void *zebra_nhg_hash_alloc(void *arg)
 	return nhe;
 }
 
-uint32_t zebra_nhg_hash_key(const void *arg)
+static uint32_t zebra_nhg_hash_key_compute(const struct nhg_hash_entry *nhe)
 {
-	const struct nhg_hash_entry *nhe = arg;
 	uint32_t key = 0x5a351234;
 	uint32_t primary = 0;
 	uint32_t backup = 0;
@@ -471,6 +471,16 @@ uint32_t zebra_nhg_hash_key(const void *arg)
 	return key;
 }
 
+uint32_t zebra_nhg_hash_key(const void *arg)
+{
+	const struct nhg_hash_entry *nhe = arg;
+
+	if (nhe->hash_key)
+		return nhe->hash_key;
+
+	return zebra_nhg_hash_key_compute(nhe);
+}
+
 uint32_t zebra_nhg_id_key(const void *arg)
 {
 	const struct nhg_hash_entry *nhe = arg;
@@ -677,14 +687,23 @@ static bool zebra_nhe_find(struct nhg_hash_entry **nhe, /* return value */
 {
 	bool created = false;
 	bool recursive = false;
+	bool hashed = false;
 	struct nhg_hash_entry *newnhe, *backup_nhe;
 	struct nexthop *nh = NULL;
 
 
 	if (lookup->id)
 		(*nhe) = zebra_nhg_lookup_id(lookup->id);
-	else
+	else {
+		/*
+		 * The lookup entry may have been modified since it was last
+		 * hashed, so always compute it fresh here. The value is
+		 * then reused if the entry gets inserted below.
+		 */
+		lookup->hash_key = zebra_nhg_hash_key_compute(lookup);
+		hashed = true;
 		(*nhe) = hash_lookup(zrouter.nhgs, lookup);
+	}
 
 	if (IS_ZEBRA_DEBUG_NHG_DETAIL)
 		zlog_debug("%s: id %u, lookup %p, vrf %d, type %d, depends %p%s => Found %p(%pNG)",
@@ -708,6 +727,8 @@ static bool zebra_nhe_find(struct nhg_hash_entry **nhe, /* return value */
 		 *
 		 * It goes in HASH and ID table.
 		 */
+		if (!hashed)
+			lookup->hash_key = zebra_nhg_hash_key_compute(lookup);
 		newnhe = hash_get(zrouter.nhgs, lookup, zebra_nhg_hash_alloc);
 		zebra_nhg_insert_id(newnhe);
 	} else {
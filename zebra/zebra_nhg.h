@@ -61,6 +61,14 @@ struct nhg_hash_entry {
 	uint32_t refcnt;
 	uint32_t dplane_ref;
 
+	/*
+	 * Cached zebra_nhg_hash_key() value. Computed once when the entry
+	 * is looked up and carried over when it is inserted, so the hash
+	 * of a large group is not walked again on insert or release.
+	 * Zero when not computed.
+	 */
+	uint32_t hash_key;
+
 	uint32_t flags;
 
 	/* Dependency trees for other entries.
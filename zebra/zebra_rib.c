@@ -56,6 +56,7 @@ DEFINE_MTYPE(ZEBRA, RE,       "Route Entry");
 DEFINE_MTYPE_STATIC(ZEBRA, RIB_DEST,       "RIB destination");
 DEFINE_MTYPE_STATIC(ZEBRA, RIB_UPDATE_CTX, "Rib update context object");
 DEFINE_MTYPE_STATIC(ZEBRA, WQ_WRAPPER, "WQ wrapper");
+DEFINE_MTYPE_STATIC(ZEBRA, MQ_VRF, "Meta queue per-VRF route nodes");
 
 /*
  * Event, list, and mutex for delivery of dataplane results
@@ -823,6 +824,8 @@ void zebra_rib_evaluate_rn_nexthops(struct route_node *rn, uint32_t seq,
 				    bool rt_delete)
 {
 	rib_dest_t *dest = rib_dest_from_rnode(rn);
+	const struct prefix *changed = &rn->p;
+	uint32_t evaluated = 0, skipped = 0;
 	struct rnh *rnh;
 
 	/*
@@ -889,7 +892,20 @@ void zebra_rib_evaluate_rn_nexthops(struct route_node *rn, uint32_t seq,
 				continue;
 			}
 
+			/*
+			 * A nexthop resolved by a less specific route can
+			 * only be affected by the changed route if it falls
+			 * within it; this keeps a more specific route change
+			 * from re-evaluating every nexthop parked on the
+			 * default route.
+			 */
+			if (&rn->p != changed && !prefix_match(changed, p)) {
+				skipped++;
+				continue;
+			}
+
 			rnh->seqno = seq;
+			evaluated++;
 			zebra_evaluate_rnh(zvrf, family2afi(p->family), 0, p,
 					   rnh->safi);
 		}
@@ -898,6 +914,12 @@ void zebra_rib_evaluate_rn_nexthops(struct route_node *rn, uint32_t seq,
 		if (rn)
 			dest = rib_dest_from_rnode(rn);
 	}
+
+	zrouter.nht_stats.route_events++;
+	zrouter.nht_stats.evaluated += evaluated;
+	zrouter.nht_stats.skipped += skipped;
+	if (evaluated > zrouter.nht_stats.max_cascade)
+		zrouter.nht_stats.max_cascade = evaluated;
 }
 
 /*
@@ -2675,6 +2697,8 @@ static void rib_re_nhg_free(struct route_entry *re)
 	nexthops_free(re->fib_ng.nexthop);
 }
 
+PREDECL_HASH(early_route_pending);
+
 struct zebra_early_route {
 	afi_t afi;
 	safi_t safi;
@@ -2686,10 +2710,67 @@ struct zebra_early_route {
 	bool startup;
 	bool deletion;
 	bool fromkernel;
+
+	/* Entry in early_route_pending, see rib_meta_queue_early_route_add */
+	struct early_route_pending_item pending_item;
+	bool pending;
 };
 
+static int early_route_pending_cmp(const struct zebra_early_route *e1,
+				   const struct zebra_early_route *e2)
+{
+	int ret;
+
+	ret = numcmp(e1->afi, e2->afi);
+	if (ret)
+		return ret;
+	ret = numcmp(e1->safi, e2->safi);
+	if (ret)
+		return ret;
+	ret = numcmp(e1->re->vrf_id, e2->re->vrf_id);
+	if (ret)
+		return ret;
+	ret = numcmp(e1->re->table, e2->re->table);
+	if (ret)
+		return ret;
+	ret = prefix_cmp(&e1->p, &e2->p);
+	if (ret)
+		return ret;
+	return prefix_cmp(&e1->src_p, &e2->src_p);
+}
+
+static uint32_t early_route_pending_hash(const struct zebra_early_route *ere)
+{
+	uint32_t key = prefix_hash_key(&ere->p);
+
+	key = jhash_3words(ere->afi, ere->safi, ere->re->vrf_id, key);
+	return jhash_2words(ere->re->table, ere->src_p.prefixlen, key);
+}
+
+DECLARE_HASH(early_route_pending, struct zebra_early_route, pending_item,
+	     early_route_pending_cmp, early_route_pending_hash);
+
+/*
+ * Kernel route adds waiting in the early route sub-queue, at most one per
+ * (table, prefix). A newer add for the same route replaces the queued one
+ * in place, so churn from other agents on the kernel FIB is collapsed for
+ * as long as the add sits in the queue.
+ */
+static struct early_route_pending_head early_route_pending;
+
+static void early_route_pending_unlink(struct zebra_early_route *ere)
+{
+	if (!ere->pending)
+		return;
+
+	early_route_pending_del(&early_route_pending, ere);
+	ere->pending = false;
+}
+
 static void early_route_memory_free(struct zebra_early_route *ere)
 {
+	early_route_pending_unlink(ere);
+
 	if (ere->re_nhe)
 		zebra_nhg_free(ere->re_nhe);
 
@@ -3148,6 +3229,8 @@ static void process_subq_early_route(struct listnode *lnode)
 {
 	struct zebra_early_route *ere = listgetdata(lnode);
 
+	early_route_pending_unlink(ere);
+
 	if (ere->deletion)
 		process_subq_early_route_delete(ere);
 	else
@@ -3171,6 +3254,54 @@ static void process_subq_gr_run(struct listnode *lnode)
 	XFREE(MTYPE_WQ_WRAPPER, gr_run);
 }
 
+static struct meta_queue_vrf *meta_queue_vrf_get(struct zebra_vrf *zvrf)
+{
+	if (!zvrf->mq_vrf) {
+		zvrf->mq_vrf = XCALLOC(MTYPE_MQ_VRF, sizeof(*zvrf->mq_vrf));
+		zvrf->mq_vrf->zvrf = zvrf;
+	}
+
+	return zvrf->mq_vrf;
+}
+
+static void meta_queue_vrf_put(struct meta_queue_vrf *mqv)
+{
+	unsigned int i;
+
+	if (mqv->size)
+		return;
+
+	for (i = 0; i < MQ_SIZE; i++)
+		if (mqv->nodes[i])
+			list_delete(&mqv->nodes[i]);
+
+	mqv->zvrf->mq_vrf = NULL;
+	XFREE(MTYPE_MQ_VRF, mqv);
+}
+
+/*
+ * Process the first route node of the VRF at the head of a route
+ * sub-queue, then move that VRF to the tail if it has more pending.
+ */
+static void process_subq_route_vrf(struct list *subq, struct listnode *lnode,
+				   uint8_t qindex)
+{
+	struct meta_queue_vrf *mqv = listgetdata(lnode);
+	struct list *nodes = mqv->nodes[qindex];
+	struct listnode *rnode = listhead(nodes);
+
+	process_subq_route(rnode, qindex);
+
+	list_delete_node(nodes, rnode);
+	mqv->size--;
+
+	list_delete_node(subq, lnode);
+	if (listcount(nodes))
+		listnode_add(subq, mqv);
+	else
+		meta_queue_vrf_put(mqv);
+}
+
 /*
  * Examine the specified subqueue; process one entry and return 1 if
  * there is a node, return 0 otherwise.
@@ -3202,8 +3333,8 @@ static unsigned int process_subq(struct list *subq,
 	case META_QUEUE_NOTBGP:
 	case META_QUEUE_BGP:
 	case META_QUEUE_OTHER:
-		process_subq_route(lnode, qindex);
-		break;
+		process_subq_route_vrf(subq, lnode, qindex);
+		return 1;
 	case META_QUEUE_GR_RUN:
 		process_subq_gr_run(lnode);
 		break;
@@ -3272,6 +3403,7 @@ static int rib_meta_queue_add(struct meta_queue *mq, void *data)
 {
 	struct route_node *rn = NULL;
 	struct route_entry *re = NULL, *curr_re = NULL;
+	struct meta_queue_vrf *mqv;
 	uint8_t qindex = MQ_SIZE, curr_qindex = MQ_SIZE;
 
 	rn = (struct route_node *)data;
@@ -3313,7 +3445,15 @@ static int rib_meta_queue_add(struct meta_queue *mq, void *data)
 	}
 
 	SET_FLAG(rib_dest_from_rnode(rn)->flags, RIB_ROUTE_QUEUED(qindex));
-	listnode_add(mq->subq[qindex], rn);
+
+	mqv = meta_queue_vrf_get(rib_dest_vrf(rib_dest_from_rnode(rn)));
+	if (!mqv->nodes[qindex])
+		mqv->nodes[qindex] = list_new();
+	if (!listcount(mqv->nodes[qindex]))
+		listnode_add(mq->subq[qindex], mqv);
+	listnode_add(mqv->nodes[qindex], rn);
+	mqv->size++;
+
 	route_lock_node(rn);
 	mq->size++;
 
@@ -3814,21 +3954,27 @@ static void early_label_meta_queue_free(struct meta_queue *mq, struct list *l,
 }
 
 static void rib_meta_queue_free(struct meta_queue *mq, struct list *l,
-				struct zebra_vrf *zvrf)
+				uint8_t qindex, struct zebra_vrf *zvrf)
 {
+	struct meta_queue_vrf *mqv;
 	struct route_node *rnode;
 	struct listnode *node, *nnode;
 
-	for (ALL_LIST_ELEMENTS(l, node, nnode, rnode)) {
-		rib_dest_t *dest = rib_dest_from_rnode(rnode);
-
-		if (dest && rib_dest_vrf(dest) != zvrf)
+	for (ALL_LIST_ELEMENTS(l, node, nnode, mqv)) {
+		if (zvrf && mqv->zvrf != zvrf)
 			continue;
 
-		route_unlock_node(rnode);
+		while ((rnode = listnode_head(mqv->nodes[qindex]))) {
+			route_unlock_node(rnode);
+			list_delete_node(mqv->nodes[qindex],
+					 listhead(mqv->nodes[qindex]));
+			mqv->size--;
+			mq->size--;
+		}
+
 		node->data = NULL;
 		list_delete_node(l, node);
-		mq->size--;
+		meta_queue_vrf_put(mqv);
 	}
 }
 
@@ -3847,6 +3993,10 @@ static void early_route_meta_queue_free(struct meta_queue *mq, struct list *l,
 		list_delete_node(l, node);
 		mq->size--;
 	}
+
+	/* The sub-queue is drained, nothing may be left pending */
+	if (!zvrf)
+		early_route_pending_fini(&early_route_pending);
 }
 
 static void rib_meta_queue_gr_run_free(struct meta_queue *mq, struct list *l,
@@ -3891,7 +4041,7 @@ void meta_queue_free(struct meta_queue *mq, struct zebra_vrf *zvrf)
 		case META_QUEUE_NOTBGP:
 		case META_QUEUE_BGP:
 		case META_QUEUE_OTHER:
-			rib_meta_queue_free(mq, mq->subq[i], zvrf);
+			rib_meta_queue_free(mq, mq->subq[i], i, zvrf);
 			break;
 		case META_QUEUE_GR_RUN:
 			rib_meta_queue_gr_run_free(mq, mq->subq[i], zvrf);
@@ -4250,19 +4400,71 @@ static int rib_meta_queue_gr_run_add(struct meta_queue *mq, void *data)
 	return 0;
 }
 
+/*
+ * Try to fold a kernel route add into an add for the same route that is
+ * still queued. Returns true if 'ere' was consumed.
+ */
+static bool early_route_coalesce(struct zebra_early_route *ere)
+{
+	struct zebra_early_route *queued;
+
+	queued = early_route_pending_find(&early_route_pending, ere);
+
+	/*
+	 * Anything else queued for this prefix must not be reordered
+	 * against a queued add, so only adds are remembered, and any
+	 * other entry for the prefix ends the window.
+	 */
+	if (ere->deletion || ere->re->type != ZEBRA_ROUTE_KERNEL) {
+		if (queued)
+			early_route_pending_unlink(queued);
+		return false;
+	}
+
+	if (queued && queued->startup == ere->startup &&
+	    rib_compare_routes(queued->re, ere->re)) {
+		if (queued->re_nhe)
+			zebra_nhg_free(queued->re_nhe);
+		zapi_re_opaque_free(queued->re->opaque);
+		XFREE(MTYPE_RE, queued->re);
+
+		queued->re = ere->re;
+		queued->re_nhe = ere->re_nhe;
+		XFREE(MTYPE_WQ_WRAPPER, ere);
+
+		zrouter.kernel_route_coalesced++;
+		return true;
+	}
+
+	if (queued)
+		early_route_pending_unlink(queued);
+
+	early_route_pending_add(&early_route_pending, ere);
+	ere->pending = true;
+
+	return false;
+}
+
 static int rib_meta_queue_early_route_add(struct meta_queue *mq, void *data)
 {
 	struct zebra_early_route *ere = data;
 
-	listnode_add(mq->subq[META_QUEUE_EARLY_ROUTE], data);
-	mq->size++;
-
 	if (IS_ZEBRA_DEBUG_RIB_DETAILED)
 		zlog_debug("Route %pFX(%u) (%s) queued for processing into sub-queue %s",
 			   &ere->p, ere->re->vrf_id,
 			   ere->deletion ? "delete" : "add",
 			   subqueue2str(META_QUEUE_EARLY_ROUTE));
 
+	if (early_route_coalesce(ere)) {
+		if (IS_ZEBRA_DEBUG_RIB_DETAILED)
+			zlog_debug("Route %pFX coalesced with queued add",
+				   &ere->p);
+		return 0;
+	}
+
+	listnode_add(mq->subq[META_QUEUE_EARLY_ROUTE], data);
+	mq->size++;
+
 	return 0;
 }
 
@@ -4623,21 +4825,39 @@ void rib_update(enum rib_update_event event)
 			   rib_update_event2str(event));
 }
 
-/* Delete self installed routes after zebra is relaunched.  */
-void rib_sweep_table(struct route_table *table)
+/*
+ * Delete self installed routes after zebra is relaunched.
+ *
+ * The walk starts at 'rn', or at the top of the table when NULL, and looks
+ * at no more than '*budget' route nodes. If the budget runs out before the
+ * end of the table, the locked node to resume from is returned.
+ */
+struct route_node *rib_sweep_table_batch(struct route_table *table,
+					 struct route_node *rn,
+					 uint32_t *budget)
 {
-	struct route_node *rn;
 	struct route_entry *re;
 	struct route_entry *next;
 	struct nexthop *nexthop;
 
 	if (!table)
-		return;
+		return NULL;
 
 	if (IS_ZEBRA_DEBUG_RIB)
-		zlog_debug("%s: starting", __func__);
+		zlog_debug("%s: %s", __func__, rn ? "resuming" : "starting");
+
+	if (!rn)
+		rn = route_top(table);
+
+	for (; rn; rn = srcdest_route_next(rn)) {
+		if (*budget == 0) {
+			if (IS_ZEBRA_DEBUG_RIB)
+				zlog_debug("%s: yielding at %pRN", __func__,
+					   rn);
+			return rn;
+		}
+		(*budget)--;
 
-	for (rn = route_top(table); rn; rn = srcdest_route_next(rn)) {
 		RNODE_FOREACH_RE_SAFE (rn, re, next) {
 
 			if (IS_ZEBRA_DEBUG_RIB)
@@ -4671,9 +4891,9 @@ void rib_sweep_table(struct route_table *table)
 			 * mark them as active when we receive them
 			 * This is startup only so probably ok.
 			 *
-			 * If we ever decide to move rib_sweep_table
-			 * to a different spot (ie startup )
-			 * this decision needs to be revisited
+			 * If we ever decide to run the batched sweep
+			 * (rib_sweep_route) at a different spot than
+			 * startup, this decision needs to be revisited
 			 */
 			SET_FLAG(re->status, ROUTE_ENTRY_INSTALLED);
 			for (ALL_NEXTHOPS(re->nhe->nhg, nexthop))
@@ -4686,23 +4906,24 @@ void rib_sweep_table(struct route_table *table)
 
 	if (IS_ZEBRA_DEBUG_RIB)
 		zlog_debug("%s: ends", __func__);
+
+	return NULL;
 }
 
-/* Sweep all RIB tables.  */
+/*
+ * Sweep all RIB tables.
+ *
+ * With a large table this is a lot of work, so it is done in batches that
+ * go back to the event loop in between, keeping zapi clients serviced.
+ */
 void rib_sweep_route(struct event *t)
 {
-	struct vrf *vrf;
-	struct zebra_vrf *zvrf;
-
-	RB_FOREACH (vrf, vrf_id_head, &vrfs_by_id) {
-		if ((zvrf = vrf->info) == NULL)
-			continue;
-
-		rib_sweep_table(zvrf->table[AFI_IP][SAFI_UNICAST]);
-		rib_sweep_table(zvrf->table[AFI_IP6][SAFI_UNICAST]);
+	if (!zebra_router_sweep_route()) {
+		event_add_timer_msec(zrouter.master, rib_sweep_route, NULL, 0,
+				     &zrouter.sweeper);
+		return;
 	}
 
-	zebra_router_sweep_route();
 	zebra_router_sweep_nhgs();
 }
 
@@ -5027,6 +5248,7 @@ void zebra_rib_init(void)
 {
 	check_route_info();
 
+	early_route_pending_init(&early_route_pending);
 	rib_queue_init();
 
 	/* Init dataplane, and register for results */
@@ -1251,7 +1251,16 @@ int zebra_send_rnh_update(struct rnh *rnh, struct zserv *client,
 	stream_putw_at(s, 0, stream_get_endp(s));
 
 	client->nh_last_upd_time = monotime(NULL);
-	return zserv_send_message(client, s);
+	client->nh_upd_cnt++;
+
+	/*
+	 * A single route change can fan out into a large number of nexthop
+	 * updates; hand them to the client pthread in one batch instead of
+	 * waking it up for each of them.  Trim the buffer first since the
+	 * whole batch is held until the end of this event loop pass.
+	 */
+	stream_resize_inplace(&s, stream_get_endp(s));
+	return zserv_send_message_deferred(client, s);
 
 failure:
 
@@ -167,15 +167,47 @@ void zebra_router_show_table_summary(struct vty *vty)
 	}
 }
 
-void zebra_router_sweep_route(void)
+/*
+ * The startup sweep covers all tables of the default namespace plus the
+ * main unicast tables of VRFs living in other namespaces.
+ */
+static bool zebra_router_sweep_wanted(struct zebra_router_table *zrt)
 {
-	struct zebra_router_table *zrt;
+	struct rib_table_info *info;
 
-	RB_FOREACH (zrt, zebra_router_table_head, &zrouter.tables) {
-		if (zrt->ns_id != NS_DEFAULT)
-			continue;
-		rib_sweep_table(zrt->table);
+	if (zrt->ns_id == NS_DEFAULT)
+		return true;
+
+	info = route_table_get_info(zrt->table);
+	return info && info->zvrf && zrt->safi == SAFI_UNICAST &&
+	       info->zvrf->table[zrt->afi][SAFI_UNICAST] == zrt->table;
+}
+
+bool zebra_router_sweep_route(void)
+{
+	uint32_t budget = ZEBRA_RIB_SWEEP_BATCH;
+
+	if (!zrouter.sweep_started) {
+		zrouter.sweep_started = true;
+		zrouter.sweep_zrt = RB_MIN(zebra_router_table_head,
+					   &zrouter.tables);
+		zrouter.sweep_rn = NULL;
+	}
+
+	while (zrouter.sweep_zrt) {
+		if (zebra_router_sweep_wanted(zrouter.sweep_zrt)) {
+			zrouter.sweep_rn = rib_sweep_table_batch(
+				zrouter.sweep_zrt->table, zrouter.sweep_rn,
+				&budget);
+			if (zrouter.sweep_rn)
+				return false;
+		}
+
+		zrouter.sweep_zrt = RB_NEXT(zebra_router_table_head,
+					    zrouter.sweep_zrt);
 	}
+
+	return true;
 }
 
 void zebra_router_sweep_nhgs(void)
@@ -187,6 +219,14 @@ static void zebra_router_free_table(struct zebra_router_table *zrt)
 {
 	void *table_info;
 
+	/* Move a startup sweep in progress off this table */
+	if (zrouter.sweep_zrt == zrt) {
+		if (zrouter.sweep_rn)
+			route_unlock_node(zrouter.sweep_rn);
+		zrouter.sweep_rn = NULL;
+		zrouter.sweep_zrt = RB_NEXT(zebra_router_table_head, zrt);
+	}
+
 	table_info = route_table_get_info(zrt->table);
 	route_table_finish(zrt->table);
 	RB_REMOVE(zebra_router_table_head, &zrouter.tables, zrt);
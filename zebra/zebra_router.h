@@ -163,6 +163,17 @@ struct zebra_router {
 	/* A sequence number used for tracking routes */
 	_Atomic uint32_t sequence_num;
 
+	/* Nexthop tracking re-evaluation triggered by route changes */
+	struct {
+		uint64_t route_events;
+		uint64_t evaluated;
+		uint64_t skipped;
+		uint32_t max_cascade;
+	} nht_stats;
+
+	/* Kernel route adds folded into an add that was still queued */
+	uint64_t kernel_route_coalesced;
+
 	/* rib work queue */
 #define ZEBRA_RIB_PROCESS_HOLD_TIME 10
 #define ZEBRA_RIB_PROCESS_RETRY_TIME 1
@@ -196,6 +207,14 @@ struct zebra_router {
 	time_t startup_time;
 	struct event *sweeper;
 
+	/*
+	 * Where the startup sweep left off: the table being walked and the
+	 * (locked) node to resume from.
+	 */
+	struct zebra_router_table *sweep_zrt;
+	struct route_node *sweep_rn;
+	bool sweep_started;
+
 	/*
 	 * The hash of nexthop groups associated with this router
 	 */
@@ -264,7 +283,15 @@ extern void zebra_router_release_table(struct zebra_vrf *zvrf, uint32_t tableid,
 
 extern int zebra_router_config_write(struct vty *vty);
 
-extern void zebra_router_sweep_route(void);
+/* Number of route nodes looked at per run of the startup sweep */
+#define ZEBRA_RIB_SWEEP_BATCH 10000
+
+/*
+ * Sweep up to ZEBRA_RIB_SWEEP_BATCH nodes worth of stale self routes,
+ * continuing where the previous call stopped. Returns true once every
+ * table has been swept.
+ */
+extern bool zebra_router_sweep_route(void);
 extern void zebra_router_sweep_nhgs(void);
 
 extern void zebra_router_show_table_summary(struct vty *vty);
@@ -3893,6 +3893,17 @@ DEFUN (show_zebra,
 	ttable_add_row(table, "v6 Default MC Forwarding|%s",
 		       zrouter.default_mc_forwardingv6 ? "On" : "Off");
 
+	ttable_add_row(table, "NHT Route Events|%" PRIu64,
+		       zrouter.nht_stats.route_events);
+	ttable_add_row(table, "NHT Evaluations|%" PRIu64,
+		       zrouter.nht_stats.evaluated);
+	ttable_add_row(table, "NHT Evaluations Skipped|%" PRIu64,
+		       zrouter.nht_stats.skipped);
+	ttable_add_row(table, "NHT Largest Cascade|%u",
+		       zrouter.nht_stats.max_cascade);
+	ttable_add_row(table, "Kernel Route Updates Coalesced|%" PRIu64,
+		       zrouter.kernel_route_coalesced);
+
 	out = ttable_dump(table, "\n");
 	vty_out(vty, "%s\n", out);
 	XFREE(MTYPE_TMP, out);
@@ -61,6 +61,9 @@ static int zsock;
 /* The lock that protects access to zapi client objects */
 static pthread_mutex_t client_mutex;
 
+/* Hands deferred messages over to the client pthreads */
+static struct event *t_deferred_flush;
+
 static struct zserv *find_client_internal(uint8_t proto,
 					  unsigned short instance,
 					  uint32_t session_id);
@@ -557,9 +560,25 @@ static void zserv_process_messages(struct event *thread)
 	zserv_client_event(client, ZSERV_CLIENT_READ);
 }
 
+/* Move deferred messages onto the output queue; obuf_mtx must be held */
+static bool zserv_deferred_move(struct zserv *client)
+{
+	struct stream *msg;
+
+	if (!stream_fifo_head(client->obuf_deferred))
+		return false;
+
+	while ((msg = stream_fifo_pop(client->obuf_deferred)))
+		stream_fifo_push(client->obuf_fifo, msg);
+
+	client->nh_upd_batch_cnt++;
+	return true;
+}
+
 int zserv_send_message(struct zserv *client, struct stream *msg)
 {
 	frr_with_mutex (&client->obuf_mtx) {
+		zserv_deferred_move(client);
 		stream_fifo_push(client->obuf_fifo, msg);
 	}
 
@@ -576,6 +595,7 @@ int zserv_send_batch(struct zserv *client, struct stream_fifo *fifo)
 	struct stream *msg;
 
 	frr_with_mutex (&client->obuf_mtx) {
+		zserv_deferred_move(client);
 		msg = stream_fifo_pop(fifo);
 		while (msg) {
 			stream_fifo_push(client->obuf_fifo, msg);
@@ -588,6 +608,34 @@ int zserv_send_batch(struct zserv *client, struct stream_fifo *fifo)
 	return 0;
 }
 
+static void zserv_deferred_flush(struct event *thread)
+{
+	struct listnode *node;
+	struct zserv *client;
+	bool moved;
+
+	for (ALL_LIST_ELEMENTS_RO(zrouter.client_list, node, client)) {
+		frr_with_mutex (&client->obuf_mtx) {
+			moved = zserv_deferred_move(client);
+		}
+
+		if (moved)
+			zserv_client_event(client, ZSERV_CLIENT_WRITE);
+	}
+}
+
+int zserv_send_message_deferred(struct zserv *client, struct stream *msg)
+{
+	frr_with_mutex (&client->obuf_mtx) {
+		stream_fifo_push(client->obuf_deferred, msg);
+	}
+
+	event_add_event(zrouter.master, zserv_deferred_flush, NULL, 0,
+			&t_deferred_flush);
+
+	return 0;
+}
+
 /* Hooks for client connect / disconnect */
 DEFINE_HOOK(zserv_client_connect, (struct zserv *client), (client));
 DEFINE_KOOH(zserv_client_close, (struct zserv *client), (client));
@@ -651,6 +699,8 @@ static void zserv_client_free(struct zserv *client)
 		stream_fifo_free(client->ibuf_fifo);
 	if (client->obuf_fifo)
 		stream_fifo_free(client->obuf_fifo);
+	if (client->obuf_deferred)
+		stream_fifo_free(client->obuf_deferred);
 	if (client->wb)
 		buffer_free(client->wb);
 
@@ -778,6 +828,7 @@ static struct zserv *zserv_client_create(int sock)
 	client->sock = sock;
 	client->ibuf_fifo = stream_fifo_new();
 	client->obuf_fifo = stream_fifo_new();
+	client->obuf_deferred = stream_fifo_new();
 	client->ibuf_work = stream_new(stream_size);
 	client->obuf_work = stream_new(stream_size);
 	client->connect_time = monotime(NULL);
@@ -923,6 +974,8 @@ void zserv_close(void)
 	close(zsock);
 	zsock = -1;
 
+	EVENT_OFF(t_deferred_flush);
+
 	/* Free client list's mutex */
 	pthread_mutex_destroy(&client_mutex);
 }
@@ -1067,6 +1120,8 @@ static void zebra_show_client_detail(struct vty *vty, struct zserv *client)
 					       ZEBRA_TIME_BUF));
 		else
 			vty_out(vty, "No Nexthop Update sent\n");
+		vty_out(vty, "Nexthop Updates: %u in %u batches\n",
+			client->nh_upd_cnt, client->nh_upd_batch_cnt);
 	} else
 		vty_out(vty, "Not registered for Nexthop Updates\n");
 
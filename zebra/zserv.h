@@ -53,7 +53,6 @@ struct client_gr_info {
 	enum zserv_client_capabilities capabilities;
 
 	/* GR commands */
-	bool do_delete;
 	bool gr_enable;
 	bool stale_client;
 
@@ -89,6 +88,10 @@ struct zserv {
 	struct stream_fifo *ibuf_fifo;
 	pthread_mutex_t obuf_mtx;
 	struct stream_fifo *obuf_fifo;
+	/* Messages held back until the end of the current event loop pass,
+	 * covered by obuf_mtx.
+	 */
+	struct stream_fifo *obuf_deferred;
 
 	/* Private I/O buffers */
 	struct stream *ibuf_work;
@@ -185,6 +188,8 @@ struct zserv {
 	uint32_t nhg_add_cnt;
 	uint32_t nhg_upd8_cnt;
 	uint32_t nhg_del_cnt;
+	uint32_t nh_upd_cnt;
+	uint32_t nh_upd_batch_cnt;
 
 	time_t nh_reg_time;
 	time_t nh_dereg_time;
@@ -286,6 +291,21 @@ extern int zserv_send_message(struct zserv *client, struct stream *msg);
  */
 extern int zserv_send_batch(struct zserv *client, struct stream_fifo *fifo);
 
+/*
+ * Queue a message to a connected Zebra API client without waking up its I/O
+ * pthread. Everything deferred during the current pass of the main event
+ * loop is handed over in one batch once that pass is done, or ahead of the
+ * next message sent with zserv_send_message(), so ordering is preserved.
+ *
+ * client
+ *    the client to send to
+ *
+ * msg
+ *    the message to send
+ */
+extern int zserv_send_message_deferred(struct zserv *client,
+				       struct stream *msg);
+
 /*
  * Retrieve a client by its protocol and instance number.
  *